@@ -0,0 +1,121 @@
+#include "counters/bench.h"
+#include "fast_float/fast_float.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+
+// Extracts the numbers of text that is mostly not numeric: with a scalar loop
+// that tries from_chars at each character that may start a number, and with
+// find_numbers. As a reference, memchr scans the same text for a character
+// that it does not contain.
+
+void pretty_print(size_t volume, size_t bytes, std::string name,
+                  counters::event_aggregate agg) {
+  if (agg.inner_count > 1) {
+    printf("# (inner count: %d)\n", agg.inner_count);
+  }
+  printf("%-40s : ", name.c_str());
+  printf(" %5.2f GB/s ", bytes / agg.fastest_elapsed_ns());
+  printf(" %5.1f Mnum/s ", volume * 1000.0 / agg.fastest_elapsed_ns());
+  printf(" %5.2f ns/num ", agg.fastest_elapsed_ns() / volume);
+  if (counters::event_collector().has_events()) {
+    printf(" %5.2f GHz ", agg.fastest_cycles() / agg.fastest_elapsed_ns());
+    printf(" %5.2f c/num ", agg.fastest_cycles() / volume);
+    printf(" %5.2f i/num ", agg.fastest_instructions() / volume);
+    printf(" %5.2f c/b ", agg.fastest_cycles() / bytes);
+    printf(" %5.2f i/b ", agg.fastest_instructions() / bytes);
+    printf(" %5.2f i/c ", agg.fastest_instructions() / agg.fastest_cycles());
+  }
+  printf("\n");
+}
+
+// The loop that find_numbers replaces.
+double sum_scalar(std::string const &text, size_t &count) {
+  double sum = 0;
+  count = 0;
+  char const *p = text.data();
+  char const *pend = p + text.size();
+  while (p != pend) {
+    char const c = *p;
+    if ((c < '0' || c > '9') && c != '-' && c != '.') {
+      ++p;
+      continue;
+    }
+    double value;
+    auto r = fast_float::from_chars(p, pend, value);
+    if (r.ec == std::errc()) {
+      sum += value;
+      ++count;
+      p = r.ptr;
+    } else {
+      ++p;
+    }
+  }
+  return sum;
+}
+
+double sum_find_numbers(std::string const &text, size_t &count) {
+  double sum = 0;
+  count = 0;
+  for (double value : fast_float::find_numbers<double>(
+           text.data(), text.data() + text.size())) {
+    sum += value;
+    ++count;
+  }
+  return sum;
+}
+
+void bench(std::string const &name, std::string const &text) {
+  size_t scalar_count = 0;
+  size_t count = 0;
+  if (sum_scalar(text, scalar_count) != sum_find_numbers(text, count) ||
+      scalar_count != count) {
+    printf("Validation failed for %s\n", name.c_str());
+    std::abort();
+  }
+  printf("# %s: %zu numbers in %zu bytes\n", name.c_str(), count, text.size());
+  volatile double sink = 0;
+  volatile size_t found = 0;
+  pretty_print(count, text.size(), name + "_memchr", counters::bench([&]() {
+                 found = found + size_t(std::memchr(text.data(), '\x01',
+                                                    text.size()) != nullptr);
+               }));
+  pretty_print(count, text.size(), name + "_scalar_loop",
+               counters::bench([&]() {
+                 size_t n;
+                 sink = sink + sum_scalar(text, n);
+               }));
+  pretty_print(count, text.size(), name + "_find_numbers",
+               counters::bench([&]() {
+                 size_t n;
+                 sink = sink + sum_find_numbers(text, n);
+               }));
+}
+
+int main() {
+  std::mt19937_64 rng(1234);
+  // Log lines, with a few numbers each.
+  std::string logs;
+  char const *paths[] = {"/api/items", "/api/users/search", "/static/app",
+                         "/healthz"};
+  for (size_t i = 0; i < 200000; ++i) {
+    logs += "INFO request handled path=";
+    logs += paths[rng() % 4];
+    logs += " latency=" + std::to_string(rng() % 1000) + "." +
+            std::to_string(rng() % 10) + "ms status=" +
+            std::to_string(200 + rng() % 4) + " user=someone\n";
+  }
+  bench("logs", logs);
+  // Prose, with a number every few hundred characters.
+  std::string prose;
+  for (size_t i = 0; i < 50000; ++i) {
+    for (size_t w = 0; w < 60; ++w) {
+      prose += (rng() % 2) ? "lorem " : "ipsum ";
+    }
+    prose += "in " + std::to_string(1900 + rng() % 125) + ", ";
+  }
+  bench("prose", prose);
+  return EXIT_SUCCESS;
+}
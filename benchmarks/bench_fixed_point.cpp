@@ -0,0 +1,103 @@
+#include "counters/bench.h"
+#include "fast_float/fast_float.h"
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+// Parses prices into integer cents: with from_chars_fixed_point, and with
+// from_chars into a double, scaled and rounded (which is not exact in
+// general, but is right for these prices).
+
+void pretty_print(size_t volume, size_t bytes, std::string name,
+                  counters::event_aggregate agg) {
+  if (agg.inner_count > 1) {
+    printf("# (inner count: %d)\n", agg.inner_count);
+  }
+  printf("%-40s : ", name.c_str());
+  printf(" %5.2f GB/s ", bytes / agg.fastest_elapsed_ns());
+  printf(" %5.1f Mint/s ", volume * 1000.0 / agg.fastest_elapsed_ns());
+  printf(" %5.2f ns/int ", agg.fastest_elapsed_ns() / volume);
+  if (counters::event_collector().has_events()) {
+    printf(" %5.2f GHz ", agg.fastest_cycles() / agg.fastest_elapsed_ns());
+    printf(" %5.2f c/int ", agg.fastest_cycles() / volume);
+    printf(" %5.2f i/int ", agg.fastest_instructions() / volume);
+    printf(" %5.2f c/b ", agg.fastest_cycles() / bytes);
+    printf(" %5.2f i/b ", agg.fastest_instructions() / bytes);
+    printf(" %5.2f i/c ", agg.fastest_instructions() / agg.fastest_cycles());
+  }
+  printf("\n");
+}
+
+// Parses the `count` values of `buffer`, each followed by a delimiter, and
+// returns their sum.
+template <typename Parse>
+int64_t parse_all(std::string const &buffer, size_t count, Parse parse) {
+  int64_t sum = 0;
+  char const *p = buffer.data();
+  char const *pend = p + buffer.size();
+  for (size_t i = 0; i < count; ++i) {
+    int64_t value = 0;
+    auto r = parse(p, pend, value);
+    if (r.ec != std::errc()) {
+      std::abort();
+    }
+    sum += value;
+    p = r.ptr + 1;
+  }
+  if (p != pend) {
+    std::abort();
+  }
+  return sum;
+}
+
+void bench(std::string const &name, std::string const &buffer, size_t count) {
+  auto fixed_point = [](char const *p, char const *pend, int64_t &value) {
+    return fast_float::from_chars_fixed_point<int64_t, 2>(p, pend, value);
+  };
+  auto through_double = [](char const *p, char const *pend, int64_t &value) {
+    double d;
+    auto r = fast_float::from_chars(p, pend, d);
+    value = std::llround(d * 100);
+    return r;
+  };
+  if (parse_all(buffer, count, fixed_point) !=
+      parse_all(buffer, count, through_double)) {
+    printf("Validation failed for %s\n", name.c_str());
+    std::abort();
+  }
+  volatile int64_t sink = 0;
+  pretty_print(count, buffer.size(), name + "_double",
+               counters::bench([&]() {
+                 sink = sink + parse_all(buffer, count, through_double);
+               }));
+  pretty_print(count, buffer.size(), name + "_fixed_point",
+               counters::bench([&]() {
+                 sink = sink + parse_all(buffer, count, fixed_point);
+               }));
+}
+
+int main() {
+  constexpr size_t N = 500000;
+  std::mt19937_64 rng(1234);
+  // Prices such as "1234.56", and the same with trailing zeros, as some feeds
+  // print them.
+  std::string prices;
+  std::string padded;
+  for (size_t i = 0; i < N; ++i) {
+    uint64_t const cents = rng() % 10000000;
+    std::string s = std::to_string(cents / 100) + "." +
+                    std::to_string(cents % 100 / 10) +
+                    std::to_string(cents % 10);
+    prices.append(s);
+    prices.push_back(',');
+    padded.append(s + "0000");
+    padded.push_back(',');
+  }
+  bench("prices", prices, N);
+  bench("prices_trailing_zeros", padded, N);
+  return EXIT_SUCCESS;
+}
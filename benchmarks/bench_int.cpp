@@ -0,0 +1,206 @@
+#include "counters/bench.h"
+#include "fast_float/fast_float.h"
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+// Parses 32- and 64-bit integers, signed and unsigned, with std::from_chars
+// and with fast_float: values of the whole range (mostly as long as the type
+// allows), and values of a random number of digits. The 128-bit integers are
+// compared with a hand-rolled loop.
+
+void pretty_print(size_t volume, size_t bytes, std::string name,
+                  counters::event_aggregate agg) {
+  if (agg.inner_count > 1) {
+    printf("# (inner count: %d)\n", agg.inner_count);
+  }
+  printf("%-40s : ", name.c_str());
+  printf(" %5.2f GB/s ", bytes / agg.fastest_elapsed_ns());
+  printf(" %5.1f Mint/s ", volume * 1000.0 / agg.fastest_elapsed_ns());
+  printf(" %5.2f ns/int ", agg.fastest_elapsed_ns() / volume);
+  if (counters::event_collector().has_events()) {
+    printf(" %5.2f GHz ", agg.fastest_cycles() / agg.fastest_elapsed_ns());
+    printf(" %5.2f c/int ", agg.fastest_cycles() / volume);
+    printf(" %5.2f i/int ", agg.fastest_instructions() / volume);
+    printf(" %5.2f c/b ", agg.fastest_cycles() / bytes);
+    printf(" %5.2f i/b ", agg.fastest_instructions() / bytes);
+    printf(" %5.2f i/c ", agg.fastest_instructions() / agg.fastest_cycles());
+  }
+  printf("\n");
+}
+
+// Parses the `count` values of `buffer`, each followed by a delimiter, and
+// returns their sum.
+template <typename T, typename Parse>
+uint64_t parse_all(std::string const &buffer, size_t count, Parse parse) {
+  uint64_t sum = 0;
+  char const *p = buffer.data();
+  char const *pend = p + buffer.size();
+  for (size_t i = 0; i < count; ++i) {
+    T value = 0;
+    auto r = parse(p, pend, value);
+    if (r.ec != std::errc()) {
+      std::abort();
+    }
+    sum += uint64_t(value);
+    p = r.ptr + 1;
+  }
+  if (p != pend) {
+    std::abort();
+  }
+  return sum;
+}
+
+template <typename T, typename Parse>
+void bench(std::string const &name, std::string const &buffer, size_t count,
+           std::string const &reference_name, Parse reference) {
+  auto fast = [](char const *p, char const *pend, T &value) {
+    return fast_float::from_chars(p, pend, value);
+  };
+  if (parse_all<T>(buffer, count, reference) !=
+      parse_all<T>(buffer, count, fast)) {
+    printf("Validation failed for %s\n", name.c_str());
+    std::abort();
+  }
+  volatile uint64_t sink = 0;
+  pretty_print(count, buffer.size(), name + "_" + reference_name,
+               counters::bench([&]() {
+                 sink = sink + parse_all<T>(buffer, count, reference);
+               }));
+  pretty_print(count, buffer.size(), name + "_fastfloat",
+               counters::bench(
+                   [&]() { sink = sink + parse_all<T>(buffer, count, fast); }));
+}
+
+// `count` values of T, each followed by a comma: uniformly distributed over
+// the range of T or, with random_length, with 1 to the maximal number of
+// digits, uniformly.
+template <typename T>
+std::string make_buffer(std::mt19937_64 &rng, size_t count,
+                        bool random_length) {
+  std::uniform_int_distribution<T> dist(std::numeric_limits<T>::min(),
+                                        std::numeric_limits<T>::max());
+  size_t const max_digits =
+      std::to_string(std::numeric_limits<T>::max()).size();
+  std::string buffer;
+  for (size_t i = 0; i < count; ++i) {
+    std::string s = std::to_string(dist(rng));
+    if (random_length) {
+      size_t const digits = 1 + size_t(rng() % max_digits);
+      size_t const sign = (s[0] == '-') ? 1 : 0;
+      if (s.size() - sign > digits) {
+        s.resize(sign + digits);
+      }
+    }
+    buffer.append(s);
+    buffer.push_back(',');
+  }
+  return buffer;
+}
+
+template <typename T> void bench_type(std::string const &name) {
+  constexpr size_t N = 500000;
+  std::mt19937_64 rng(1234);
+  auto standard = [](char const *p, char const *pend, T &value) {
+    return std::from_chars(p, pend, value);
+  };
+  bench<T>(name, make_buffer<T>(rng, N, false), N, "std_fromchars", standard);
+  bench<T>(name + "_random_length", make_buffer<T>(rng, N, true), N,
+           "std_fromchars", standard);
+}
+
+#ifdef FASTFLOAT_HAS_INT128
+
+// A hand-rolled loop for the 128-bit integers in base 10: digit by digit,
+// with the overflow checked on each digit.
+template <typename T>
+fast_float::from_chars_result parse_int128_loop(char const *p,
+                                                char const *pend, T &value) {
+  fast_float::from_chars_result answer{p, std::errc::invalid_argument};
+  bool const negative =
+      std::numeric_limits<T>::is_signed && (p != pend) && (*p == '-');
+  if (negative) {
+    ++p;
+  }
+  char const *const start = p;
+  __uint128_t i = 0;
+  bool overflow = false;
+  while ((p != pend) && (*p >= '0') && (*p <= '9')) {
+    unsigned const digit = unsigned(*p - '0');
+    if (i > (~__uint128_t(0) - 9) / 10) {
+      overflow |= (i > ~__uint128_t(0) / 10) ||
+                  (digit > unsigned(~__uint128_t(0) % 10));
+    }
+    i = i * 10 + digit;
+    ++p;
+  }
+  if (p == start) {
+    return answer;
+  }
+  answer.ptr = p;
+  if (overflow ||
+      (i > __uint128_t(std::numeric_limits<T>::max()) + negative)) {
+    answer.ec = std::errc::result_out_of_range;
+    return answer;
+  }
+  value = negative ? T(0 - i) : T(i);
+  answer.ec = std::errc();
+  return answer;
+}
+
+// As make_buffer, for the 128-bit integers.
+template <typename T>
+std::string make_buffer_128(std::mt19937_64 &rng, size_t count,
+                            bool random_length) {
+  bool const is_signed = std::numeric_limits<T>::is_signed;
+  std::string buffer;
+  for (size_t i = 0; i < count; ++i) {
+    __uint128_t v = (__uint128_t(rng()) << 64) | rng();
+    if (is_signed) {
+      v >>= 1;
+    }
+    std::string s;
+    do {
+      s.insert(s.begin(), char('0' + unsigned(v % 10)));
+      v /= 10;
+    } while (v != 0);
+    if (random_length) {
+      s.resize(std::min(s.size(), size_t(1 + rng() % 39)));
+    }
+    if (is_signed && (rng() % 2 == 0)) {
+      s.insert(s.begin(), '-');
+    }
+    buffer.append(s);
+    buffer.push_back(',');
+  }
+  return buffer;
+}
+
+template <typename T> void bench_type_128(std::string const &name) {
+  constexpr size_t N = 500000;
+  std::mt19937_64 rng(1234);
+  bench<T>(name, make_buffer_128<T>(rng, N, false), N, "loop",
+           parse_int128_loop<T>);
+  bench<T>(name + "_random_length", make_buffer_128<T>(rng, N, true), N,
+           "loop", parse_int128_loop<T>);
+}
+
+#endif
+
+int main() {
+  bench_type<uint32_t>("uint32");
+  bench_type<int32_t>("int32");
+  bench_type<uint64_t>("uint64");
+  bench_type<int64_t>("int64");
+#ifdef FASTFLOAT_HAS_INT128
+  bench_type_128<__uint128_t>("uint128");
+  bench_type_128<__int128_t>("int128");
+#endif
+  return EXIT_SUCCESS;
+}
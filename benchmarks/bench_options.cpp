@@ -0,0 +1,106 @@
+#include "counters/bench.h"
+#include "fast_float/fast_float.h"
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+// Compares the parse options given at run time (from_chars_advanced) with the
+// same options given as template arguments (from_chars<T, Fmt>).
+
+void pretty_print(size_t volume, size_t bytes, std::string name,
+                  counters::event_aggregate agg) {
+  if (agg.inner_count > 1) {
+    printf("# (inner count: %d)\n", agg.inner_count);
+  }
+  printf("%-40s : ", name.c_str());
+  printf(" %5.2f GB/s ", bytes / agg.fastest_elapsed_ns());
+  printf(" %5.1f Mfloat/s ", volume * 1000.0 / agg.fastest_elapsed_ns());
+  printf(" %5.2f ns/f ", agg.fastest_elapsed_ns() / volume);
+  if (counters::event_collector().has_events()) {
+    printf(" %5.2f GHz ", agg.fastest_cycles() / agg.fastest_elapsed_ns());
+    printf(" %5.2f c/f ", agg.fastest_cycles() / volume);
+    printf(" %5.2f i/f ", agg.fastest_instructions() / volume);
+    printf(" %5.2f c/b ", agg.fastest_cycles() / bytes);
+    printf(" %5.2f i/b ", agg.fastest_instructions() / bytes);
+    printf(" %5.2f i/c ", agg.fastest_instructions() / agg.fastest_cycles());
+  }
+  printf("\n");
+}
+
+// Parses the `count` values of `buffer`, each followed by a delimiter.
+template <typename Parse>
+double parse_all(std::string const &buffer, size_t count, Parse parse) {
+  double sum = 0;
+  char const *p = buffer.data();
+  char const *pend = p + buffer.size();
+  for (size_t i = 0; i < count; ++i) {
+    double value;
+    auto r = parse(p, pend, value);
+    if (r.ec != std::errc()) {
+      std::abort();
+    }
+    sum += value;
+    p = r.ptr + 1;
+  }
+  if (p != pend) {
+    std::abort();
+  }
+  return sum;
+}
+
+template <fast_float::chars_format Fmt, char DecimalPoint>
+void bench(std::string const &name, std::string const &buffer, size_t count) {
+  // The options are opaque to the compiler, as when they come from a
+  // configuration.
+  volatile uint64_t format = uint64_t(Fmt);
+  volatile char decimal_point = DecimalPoint;
+  fast_float::parse_options const options(fast_float::chars_format(format),
+                                          decimal_point);
+  auto runtime = [&](char const *p, char const *pend, double &value) {
+    return fast_float::from_chars_advanced(p, pend, value, options);
+  };
+  auto constant = [](char const *p, char const *pend, double &value) {
+    return fast_float::from_chars<double, Fmt, DecimalPoint>(p, pend, value);
+  };
+  if (parse_all(buffer, count, runtime) != parse_all(buffer, count, constant)) {
+    printf("Validation failed for %s\n", name.c_str());
+    std::abort();
+  }
+  volatile double sink = 0;
+  pretty_print(count, buffer.size(), name + "_runtime_options",
+               counters::bench(
+                   [&]() { sink = parse_all(buffer, count, runtime); }));
+  pretty_print(count, buffer.size(), name + "_constant_options",
+               counters::bench(
+                   [&]() { sink = parse_all(buffer, count, constant); }));
+}
+
+int main() {
+  constexpr size_t N = 500000;
+  std::mt19937_64 rng(1234);
+  std::uniform_real_distribution<double> dist(-1000, 1000);
+
+  std::string json;
+  std::string comma;
+  for (size_t i = 0; i < N; ++i) {
+    std::string s = std::to_string(dist(rng));
+    json.append(s);
+    json.push_back(',');
+    for (char &c : s) {
+      if (c == '.') {
+        c = ',';
+      }
+    }
+    comma.append(s);
+    comma.push_back(';');
+  }
+
+  bench<fast_float::chars_format::json, '.'>("json", json, N);
+  bench<fast_float::chars_format::general, '.'>("general", json, N);
+  bench<fast_float::chars_format::general, ','>("general_decimal_comma", comma,
+                                                N);
+  return EXIT_SUCCESS;
+}
@@ -50,6 +50,50 @@ double findmax_fastfloat32(std::vector<std::basic_string<CharT>> &s) {
   return answer;
 }
 
+// Same as findmax_fastfloat64, but the values are parsed from a single buffer
+// (one value per line) with one call to from_chars_many.
+template <typename CharT>
+double findmax_fastfloat64_many(std::basic_string<CharT> const &buffer,
+                                std::vector<double> &values) {
+  auto answer = fast_float::from_chars_many(
+      buffer.data(), buffer.data() + buffer.size(), values.data(),
+      values.size());
+  if (!answer || answer.count != values.size()) {
+    throw std::runtime_error("bug in findmax_fastfloat64_many");
+  }
+  double answer_max = 0;
+  for (double x : values) {
+    answer_max = answer_max > x ? answer_max : x;
+  }
+  return answer_max;
+}
+
+// Same as findmax_fastfloat64_many, but the values are folded with
+// parse_reduce as they are parsed, without the array of values.
+template <typename CharT>
+double findmax_fastfloat64_reduce(std::basic_string<CharT> const &buffer,
+                                  size_t count) {
+  fast_float::max_reducer<double> reducer;
+  auto answer = fast_float::parse_reduce(
+      buffer.data(), buffer.data() + buffer.size(),
+      fast_float::separator_set::white_space(), reducer);
+  if (!answer || answer.count != count) {
+    throw std::runtime_error("bug in findmax_fastfloat64_reduce");
+  }
+  return reducer.max();
+}
+
+template <typename CharT>
+std::basic_string<CharT>
+join_lines(std::vector<std::basic_string<CharT>> const &lines) {
+  std::basic_string<CharT> buffer;
+  for (auto const &line : lines) {
+    buffer += line;
+    buffer += CharT('\n');
+  }
+  return buffer;
+}
+
 counters::event_collector collector{};
 
 #ifdef USING_COUNTERS
@@ -194,6 +238,22 @@ void process(std::vector<std::string> &lines, size_t volume) {
                time_it_ns(lines, findmax_fastfloat64<char>, repeat));
   pretty_print(volume, lines.size(), "fastfloat (32)",
                time_it_ns(lines, findmax_fastfloat32<char>, repeat));
+  std::string const buffer = join_lines(lines);
+  std::vector<double> values(lines.size());
+  pretty_print(volume, lines.size(), "fastfloat many (64)",
+               time_it_ns(
+                   lines,
+                   [&](std::vector<std::string> &) {
+                     return findmax_fastfloat64_many(buffer, values);
+                   },
+                   repeat));
+  pretty_print(volume, lines.size(), "fastfloat reduce (64)",
+               time_it_ns(
+                   lines,
+                   [&](std::vector<std::string> &) {
+                     return findmax_fastfloat64_reduce(buffer, lines.size());
+                   },
+                   repeat));
 
   std::vector<std::u16string> lines16 = widen(lines);
   volume = 2 * volume;
@@ -203,6 +263,21 @@ void process(std::vector<std::string> &lines, size_t volume) {
                time_it_ns(lines16, findmax_fastfloat64<char16_t>, repeat));
   pretty_print(volume, lines.size(), "fastfloat (32)",
                time_it_ns(lines16, findmax_fastfloat32<char16_t>, repeat));
+  std::u16string const buffer16 = join_lines(lines16);
+  pretty_print(volume, lines.size(), "fastfloat many (64)",
+               time_it_ns(
+                   lines16,
+                   [&](std::vector<std::u16string> &) {
+                     return findmax_fastfloat64_many(buffer16, values);
+                   },
+                   repeat));
+  pretty_print(volume, lines.size(), "fastfloat reduce (64)",
+               time_it_ns(
+                   lines16,
+                   [&](std::vector<std::u16string> &) {
+                     return findmax_fastfloat64_reduce(buffer16, lines.size());
+                   },
+                   repeat));
 }
 
 void fileload(std::string filename) {
@@ -226,6 +301,30 @@ void fileload(std::string filename) {
   process(lines, volume);
 }
 
+// Random values printed with 20 to 25 significant digits, which is more than
+// the 19 digits that fit in the 64-bit mantissa of the parser.
+void long_mantissa_load(size_t count) {
+  std::cout << "#### " << std::endl;
+  std::cout << "# generating " << count << " numbers with long mantissas"
+            << std::endl;
+  std::cout << "#### " << std::endl;
+  std::mt19937_64 rng(1234);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  std::uniform_int_distribution<int> digits(20, 25);
+  std::uniform_int_distribution<int> power(-30, 30);
+  std::vector<std::string> lines;
+  lines.reserve(count);
+  size_t volume = 0;
+  char buffer[64];
+  for (size_t i = 0; i < count; i++) {
+    double const v = dist(rng) * std::pow(10.0, power(rng));
+    int const len = snprintf(buffer, sizeof(buffer), "%.*g", digits(rng), v);
+    lines.emplace_back(buffer, size_t(len));
+    volume += lines.back().size();
+  }
+  process(lines, volume);
+}
+
 int main(int argc, char **argv) {
   if (collector.has_events()) {
     std::cout << "# Using hardware counters" << std::endl;
@@ -242,5 +341,6 @@ int main(int argc, char **argv) {
   }
   fileload(std::string(BENCHMARK_DATA_DIR) + "/canada.txt");
   fileload(std::string(BENCHMARK_DATA_DIR) + "/mesh.txt");
+  long_mantissa_load(100000);
   return EXIT_SUCCESS;
 }
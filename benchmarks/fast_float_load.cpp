@@ -0,0 +1,183 @@
+// fast_float_load: parses a text file of numbers in place, from a memory
+// mapping, and reports the end-to-end throughput.
+//
+// usage: fast_float_load [options] file
+//   --float         parse as float (default: double)
+//   --threads N     use from_chars_many_parallel with N threads (0: all)
+//   --single        parse with a loop of from_chars_advanced calls
+//   --sep CHARS     the separators (default: white space)
+//   --repeat N      parse the file N times and keep the best (default: 10)
+//   --kernel NAME   force the SIMD kernel: scalar, sse2, avx2 or avx512
+//                   (default: the best one that the processor supports)
+#define FASTFLOAT_RUNTIME_DISPATCH 1
+#include "fast_float/parallel_parse.h"
+#include "mapped_file.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+
+struct load_options {
+  bool single = false;
+  unsigned threads = 1;
+  fast_float::separator_set separators =
+      fast_float::separator_set::white_space();
+  size_t repeat = 10;
+};
+
+char const *kernel_name(fast_float::simd_kernel kernel) {
+  switch (kernel) {
+  case fast_float::simd_kernel::sse2:
+    return "sse2";
+  case fast_float::simd_kernel::avx2:
+    return "avx2";
+  case fast_float::simd_kernel::avx512:
+    return "avx512";
+  default:
+    return "scalar";
+  }
+}
+
+template <typename T>
+fast_float::from_chars_many_result_t<char>
+parse_file(char const *first, char const *last, T *out, size_t max,
+           load_options const &opts) {
+  if (!opts.single) {
+    if (opts.threads == 1) {
+      return fast_float::from_chars_many(first, last, out, max,
+                                         opts.separators);
+    }
+    return fast_float::from_chars_many_parallel(first, last, out, max,
+                                                opts.threads, opts.separators);
+  }
+  fast_float::from_chars_many_result_t<char> answer;
+  answer.ec = std::errc();
+  answer.count = 0;
+  fast_float::parse_options const options;
+  for (char const *p = first;;) {
+    while (p != last && opts.separators.contains(*p)) {
+      ++p;
+    }
+    answer.ptr = p;
+    if (p == last || answer.count == max) {
+      return answer;
+    }
+    auto const r = fast_float::from_chars_advanced(p, last, out[answer.count],
+                                                   options);
+    if (r.ec != std::errc() ||
+        (r.ptr != last && !opts.separators.contains(*r.ptr))) {
+      answer.ec = (r.ec != std::errc()) ? r.ec : std::errc::invalid_argument;
+      return answer;
+    }
+    ++answer.count;
+    p = r.ptr;
+  }
+}
+
+template <typename T>
+int load(std::string const &path, load_options const &opts) {
+  using clock = std::chrono::steady_clock;
+  auto const start = clock::now();
+  mapped_file file;
+  if (!file.open(path)) {
+    std::fprintf(stderr, "can't open %s\n", path.c_str());
+    return EXIT_FAILURE;
+  }
+  char const *first = file.data();
+  char const *last = first + file.size();
+  // At most one number every two bytes. The array is not initialized, so
+  // that only the pages that receive values are touched.
+  size_t const max = file.size() / 2 + 1;
+  std::unique_ptr<T[]> values(new T[max]);
+
+  double first_ns = 0;
+  double best_ns = 0;
+  fast_float::from_chars_many_result_t<char> answer{first, std::errc(), 0};
+  for (size_t i = 0; i < opts.repeat; i++) {
+    auto const t1 = clock::now();
+    answer = parse_file(first, last, values.get(), max, opts);
+    auto const t2 = clock::now();
+    double const ns = double(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count());
+    if (i == 0) {
+      // The first run includes the mapping and the page faults.
+      first_ns = double(
+          std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - start)
+              .count());
+      best_ns = ns;
+    }
+    best_ns = ns < best_ns ? ns : best_ns;
+    if (!answer) {
+      break;
+    }
+  }
+  if (!answer) {
+    size_t const offset = size_t(answer.ptr - first);
+    std::fprintf(stderr, "%s: invalid number %zu at offset %zu\n",
+                 path.c_str(), answer.count, offset);
+    return EXIT_FAILURE;
+  }
+  double sum = 0;
+  for (size_t i = 0; i < answer.count; i++) {
+    sum += double(values[i]);
+  }
+  double const bytes = double(file.size());
+  std::printf("# %s: %zu bytes (%s), %zu numbers, sum %g, %s kernel\n",
+              path.c_str(), file.size(), file.is_mapped() ? "mapped" : "read",
+              answer.count, sum,
+              kernel_name(fast_float::active_simd_kernel()));
+  std::printf("%-24s: %8.3f GB/s %8.2f Mfloat/s\n", "first run (with I/O)",
+              bytes / first_ns, double(answer.count) * 1000 / first_ns);
+  std::printf("%-24s: %8.3f GB/s %8.2f Mfloat/s\n", "best run",
+              bytes / best_ns, double(answer.count) * 1000 / best_ns);
+  return EXIT_SUCCESS;
+}
+
+int main(int argc, char **argv) {
+  load_options opts;
+  bool as_float = false;
+  char const *path = nullptr;
+  for (int i = 1; i < argc; i++) {
+    bool const has_value = i + 1 < argc;
+    if (std::strcmp(argv[i], "--float") == 0) {
+      as_float = true;
+    } else if (std::strcmp(argv[i], "--single") == 0) {
+      opts.single = true;
+    } else if (std::strcmp(argv[i], "--threads") == 0 && has_value) {
+      opts.threads = unsigned(std::strtoul(argv[++i], nullptr, 10));
+    } else if (std::strcmp(argv[i], "--sep") == 0 && has_value) {
+      opts.separators = fast_float::separator_set(argv[++i]);
+    } else if (std::strcmp(argv[i], "--repeat") == 0 && has_value) {
+      opts.repeat = size_t(std::strtoul(argv[++i], nullptr, 10));
+    } else if (std::strcmp(argv[i], "--kernel") == 0 && has_value) {
+      char const *name = argv[++i];
+      bool forced = false;
+      for (int k = 0; k <= int(fast_float::simd_kernel::avx512); k++) {
+        fast_float::simd_kernel const kernel = fast_float::simd_kernel(k);
+        if (std::strcmp(name, kernel_name(kernel)) == 0) {
+          forced = fast_float::force_simd_kernel(kernel);
+        }
+      }
+      if (!forced) {
+        std::fprintf(stderr, "kernel %s is not supported\n", name);
+        return EXIT_FAILURE;
+      }
+    } else if (argv[i][0] != '-' && path == nullptr) {
+      path = argv[i];
+    } else {
+      path = nullptr;
+      break;
+    }
+  }
+  if (path == nullptr || opts.repeat == 0) {
+    std::fprintf(stderr,
+                 "usage: %s [--float] [--threads N] [--single] [--sep CHARS] "
+                 "[--repeat N] [--kernel NAME] file\n",
+                 argv[0]);
+    return EXIT_FAILURE;
+  }
+  return as_float ? load<float>(path, opts) : load<double>(path, opts);
+}
@@ -0,0 +1,95 @@
+#ifndef FASTFLOAT_BENCHMARKS_MAPPED_FILE_H
+#define FASTFLOAT_BENCHMARKS_MAPPED_FILE_H
+
+#include <cstddef>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define FASTFLOAT_BENCHMARKS_MMAP 1
+#endif
+
+// A read-only view of a whole file, to parse it in place. Where mmap is
+// available, the file is mapped in memory, with hints for sequential reading
+// (and transparent huge pages, where supported); otherwise, it is read into a
+// single buffer.
+class mapped_file {
+public:
+  mapped_file() = default;
+  mapped_file(mapped_file const &) = delete;
+  mapped_file &operator=(mapped_file const &) = delete;
+  ~mapped_file() { close(); }
+
+  bool open(std::string const &path) {
+    close();
+#ifdef FASTFLOAT_BENCHMARKS_MMAP
+    int const fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+      return false;
+    }
+    struct stat st;
+    if (::fstat(fd, &st) != 0) {
+      ::close(fd);
+      return false;
+    }
+    length = size_t(st.st_size);
+    if (length == 0) {
+      ::close(fd);
+      begin = "";
+      return true;
+    }
+    void *p = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (p != MAP_FAILED) {
+      ::madvise(p, length, MADV_SEQUENTIAL);
+#ifdef MADV_HUGEPAGE
+      ::madvise(p, length, MADV_HUGEPAGE);
+#endif
+      begin = static_cast<char const *>(p);
+      mapped = true;
+      return true;
+    }
+    length = 0;
+#endif
+    // Fallback: read the file at once.
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+      return false;
+    }
+    buffer.assign(std::istreambuf_iterator<char>(file),
+                  std::istreambuf_iterator<char>());
+    begin = buffer.data();
+    length = buffer.size();
+    return true;
+  }
+
+  void close() {
+#ifdef FASTFLOAT_BENCHMARKS_MMAP
+    if (mapped) {
+      ::munmap(const_cast<char *>(begin), length);
+    }
+#endif
+    begin = nullptr;
+    length = 0;
+    mapped = false;
+    buffer.clear();
+  }
+
+  char const *data() const { return begin; }
+  size_t size() const { return length; }
+  bool is_mapped() const { return mapped; }
+
+private:
+  char const *begin{nullptr};
+  size_t length{0};
+  bool mapped{false};
+  std::vector<char> buffer{};
+};
+
+#endif
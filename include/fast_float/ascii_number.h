@@ -14,6 +14,14 @@
 #include <emmintrin.h>
 #endif
 
+#ifdef FASTFLOAT_AVX2
+#include <immintrin.h>
+#endif
+
+#if defined(FASTFLOAT_SSSE3) || defined(FASTFLOAT_X86_DISPATCH)
+#include <tmmintrin.h>
+#endif
+
 #ifdef FASTFLOAT_NEON
 #include <arm_neon.h>
 #endif
@@ -22,7 +30,10 @@ namespace fast_float {
 
 template <typename UC> fastfloat_really_inline constexpr bool has_simd_opt() {
 #ifdef FASTFLOAT_HAS_SIMD
-  return std::is_same<UC, char16_t>::value;
+  return std::is_same<UC, char16_t>::value ||
+         std::is_same<UC, char32_t>::value ||
+         (std::is_same<UC, wchar_t>::value &&
+          (sizeof(wchar_t) == 2 || sizeof(wchar_t) == 4));
 #else
   return false;
 #endif
@@ -103,10 +114,30 @@ fastfloat_really_inline uint64_t simd_read8_to_u64(__m128i const data) {
   FASTFLOAT_SIMD_RESTORE_WARNINGS
 }
 
-fastfloat_really_inline uint64_t simd_read8_to_u64(char16_t const *chars) {
+using simd_u16x8 = __m128i;
+
+// Loads eight code units into 16-bit lanes. UTF-32 code units are narrowed
+// with saturation, so that the large ones cannot pass for digits.
+fastfloat_really_inline __m128i simd_load8_u16(char16_t const *chars) {
+  FASTFLOAT_SIMD_DISABLE_WARNINGS
+  return _mm_loadu_si128(reinterpret_cast<__m128i const *>(chars));
+  FASTFLOAT_SIMD_RESTORE_WARNINGS
+}
+
+fastfloat_really_inline __m128i simd_load8_u16(char32_t const *chars) {
   FASTFLOAT_SIMD_DISABLE_WARNINGS
-  return simd_read8_to_u64(
-      _mm_loadu_si128(reinterpret_cast<__m128i const *>(chars)));
+#ifdef FASTFLOAT_AVX2
+  __m256i const data =
+      _mm256_loadu_si256(reinterpret_cast<__m256i const *>(chars));
+  // The packing works within the 128-bit halves: gather the low 64 bits of
+  // each.
+  __m256i const packed = _mm256_packs_epi32(data, data);
+  return _mm256_castsi256_si128(_mm256_permute4x64_epi64(packed, 0x08));
+#else
+  return _mm_packs_epi32(
+      _mm_loadu_si128(reinterpret_cast<__m128i const *>(chars)),
+      _mm_loadu_si128(reinterpret_cast<__m128i const *>(chars + 4)));
+#endif
   FASTFLOAT_SIMD_RESTORE_WARNINGS
 }
 
@@ -119,15 +150,48 @@ fastfloat_really_inline uint64_t simd_read8_to_u64(uint16x8_t const data) {
   FASTFLOAT_SIMD_RESTORE_WARNINGS
 }
 
-fastfloat_really_inline uint64_t simd_read8_to_u64(char16_t const *chars) {
+using simd_u16x8 = uint16x8_t;
+
+fastfloat_really_inline uint16x8_t simd_load8_u16(char16_t const *chars) {
   FASTFLOAT_SIMD_DISABLE_WARNINGS
-  return simd_read8_to_u64(
-      vld1q_u16(reinterpret_cast<uint16_t const *>(chars)));
+  return vld1q_u16(reinterpret_cast<uint16_t const *>(chars));
+  FASTFLOAT_SIMD_RESTORE_WARNINGS
+}
+
+fastfloat_really_inline uint16x8_t simd_load8_u16(char32_t const *chars) {
+  FASTFLOAT_SIMD_DISABLE_WARNINGS
+  uint32_t const *units = reinterpret_cast<uint32_t const *>(chars);
+  return vcombine_u16(vqmovn_u32(vld1q_u32(units)),
+                      vqmovn_u32(vld1q_u32(units + 4)));
   FASTFLOAT_SIMD_RESTORE_WARNINGS
 }
 
 #endif // FASTFLOAT_SSE2
 
+#ifdef FASTFLOAT_HAS_SIMD
+
+// wchar_t is UTF-16 (Windows) or UTF-32.
+using wchar_code_unit =
+    std::conditional<sizeof(wchar_t) == 2, char16_t, char32_t>::type;
+
+fastfloat_really_inline simd_u16x8 simd_load8_u16(wchar_t const *chars) {
+  return simd_load8_u16(reinterpret_cast<wchar_code_unit const *>(chars));
+}
+
+fastfloat_really_inline uint64_t simd_read8_to_u64(char16_t const *chars) {
+  return simd_read8_to_u64(simd_load8_u16(chars));
+}
+
+fastfloat_really_inline uint64_t simd_read8_to_u64(char32_t const *chars) {
+  return simd_read8_to_u64(simd_load8_u16(chars));
+}
+
+fastfloat_really_inline uint64_t simd_read8_to_u64(wchar_t const *chars) {
+  return simd_read8_to_u64(simd_load8_u16(chars));
+}
+
+#endif // FASTFLOAT_HAS_SIMD
+
 // MSVC SFINAE is broken pre-VS2017
 #if defined(_MSC_VER) && _MSC_VER <= 1900
 template <typename UC>
@@ -180,21 +244,63 @@ parse_four_digits_unrolled(uint32_t val) noexcept {
   return (((val & 0x00FF00FF) * 0x00640001) >> 16) & 0xFFFF;
 }
 
+// 0x80 in the bytes of val that are 'a' to 'f' or 'A' to 'F'. A carry only
+// crosses a byte that is not ASCII, so the bytes up to the first such one are
+// exact.
+fastfloat_really_inline constexpr uint64_t
+hex_letters_in_eight(uint64_t val) noexcept {
+  return ((val | 0x2020202020202020) + 0x1F1F1F1F1F1F1F1F) &
+         ~((val | 0x2020202020202020) + 0x1919191919191919) &
+         0x8080808080808080;
+}
+
+// The high bit of each byte that is not a hexadecimal digit: the lowest one is
+// exact.
+fastfloat_really_inline constexpr uint64_t
+non_hex_digits_in_eight(uint64_t val) noexcept {
+  return ~((((val + 0x5050505050505050) & ~(val + 0x4646464646464646)) |
+            hex_letters_in_eight(val)) &
+           ~val) &
+         0x8080808080808080;
+}
+
+// The value of the first n (1 to 8) bytes of val, which are digits of
+// `bits` bits (1, 3 or 4: bases 2, 8 and 16), the first one in the lowest
+// byte.
+fastfloat_really_inline FASTFLOAT_CONSTEXPR14 uint32_t
+combine_pow2_digits(uint64_t val, size_t n, int bits) noexcept {
+  // The n digits as the last ones of eight, after leading zeros.
+  val <<= (8 - n) * 8;
+  // Pairs of digits, then of pairs, then of quadruples, the first one of each
+  // pair being the most significant.
+  val = ((val << bits) | (val >> 8)) & 0x00FF00FF00FF00FF;
+  val = ((val << (2 * bits)) | (val >> 16)) & 0x0000FFFF0000FFFF;
+  return uint32_t((val << (4 * bits)) | (val >> 32));
+}
+
+// The value of the first n (1 to 8) bytes of val, which are hexadecimal
+// digits, the first one in the lowest byte.
+fastfloat_really_inline FASTFLOAT_CONSTEXPR14 uint32_t
+parse_hex_digits_unrolled(uint64_t val, size_t n) noexcept {
+  // The nibbles: 'a' is 0x61 and 'A' is 0x41, so their low nibble is 1.
+  return combine_pow2_digits(
+      (val & 0x0F0F0F0F0F0F0F0F) + (hex_letters_in_eight(val) >> 7) * 9, n, 4);
+}
+
 #ifdef FASTFLOAT_HAS_SIMD
 
 // Call this if chars might not be 8 digits.
 // Using this style (instead of is_made_of_eight_digits_fast() then
 // parse_eight_digits_unrolled()) ensures we don't load SIMD registers twice.
+template <typename UC>
 fastfloat_really_inline FASTFLOAT_CONSTEXPR20 bool
-simd_parse_if_eight_digits_unrolled(char16_t const *chars,
-                                    uint64_t &i) noexcept {
+simd_parse_if_eight_digits_impl(UC const *chars, uint64_t &i) noexcept {
   if (cpp20_and_in_constexpr()) {
     return false;
   }
 #ifdef FASTFLOAT_SSE2
   FASTFLOAT_SIMD_DISABLE_WARNINGS
-  __m128i const data =
-      _mm_loadu_si128(reinterpret_cast<__m128i const *>(chars));
+  __m128i const data = simd_load8_u16(chars);
 
   // (x - '0') <= 9
   // http://0x80.pl/articles/simd-parsing-int-sequences.html
@@ -209,7 +315,7 @@ simd_parse_if_eight_digits_unrolled(char16_t const *chars,
   FASTFLOAT_SIMD_RESTORE_WARNINGS
 #elif defined(FASTFLOAT_NEON)
   FASTFLOAT_SIMD_DISABLE_WARNINGS
-  uint16x8_t const data = vld1q_u16(reinterpret_cast<uint16_t const *>(chars));
+  uint16x8_t const data = simd_load8_u16(chars);
 
   // (x - '0') <= 9
   // http://0x80.pl/articles/simd-parsing-int-sequences.html
@@ -229,6 +335,24 @@ simd_parse_if_eight_digits_unrolled(char16_t const *chars,
 #endif // FASTFLOAT_SSE2
 }
 
+fastfloat_really_inline FASTFLOAT_CONSTEXPR20 bool
+simd_parse_if_eight_digits_unrolled(char16_t const *chars,
+                                    uint64_t &i) noexcept {
+  return simd_parse_if_eight_digits_impl(chars, i);
+}
+
+fastfloat_really_inline FASTFLOAT_CONSTEXPR20 bool
+simd_parse_if_eight_digits_unrolled(char32_t const *chars,
+                                    uint64_t &i) noexcept {
+  return simd_parse_if_eight_digits_impl(chars, i);
+}
+
+fastfloat_really_inline FASTFLOAT_CONSTEXPR20 bool
+simd_parse_if_eight_digits_unrolled(wchar_t const *chars,
+                                    uint64_t &i) noexcept {
+  return simd_parse_if_eight_digits_impl(chars, i);
+}
+
 #endif // FASTFLOAT_HAS_SIMD
 
 // MSVC SFINAE is broken pre-VS2017
@@ -242,7 +366,376 @@ bool simd_parse_if_eight_digits_unrolled(UC const *, uint64_t &) {
   return 0;
 }
 
-template <typename UC, FASTFLOAT_ENABLE_IF(!std::is_same<UC, char>::value) = 0>
+#ifdef FASTFLOAT_HAS_SIMD
+
+// The number of white-space code units (see is_space) at the start of the
+// block at p: 32 code units for char with AVX2, 16 otherwise. Wider code units
+// are narrowed to bytes with saturation, which keeps them out of the white
+// space.
+template <typename UC> constexpr int simd_space_block() {
+#ifdef FASTFLOAT_AVX2
+  return std::is_same<UC, char>::value ? 32 : 16;
+#else
+  return 16;
+#endif
+}
+
+#ifdef FASTFLOAT_SSE2
+
+#ifdef FASTFLOAT_AVX2
+fastfloat_really_inline uint32_t simd_leading_spaces(char const *p) noexcept {
+  FASTFLOAT_SIMD_DISABLE_WARNINGS
+  __m256i const v = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(p));
+  // '\t' to '\r' are 9 to 13
+  __m256i const control = _mm256_sub_epi8(v, _mm256_set1_epi8(9));
+  __m256i const spaces = _mm256_or_si256(
+      _mm256_cmpeq_epi8(v, _mm256_set1_epi8(' ')),
+      _mm256_cmpeq_epi8(_mm256_min_epu8(control, _mm256_set1_epi8(4)),
+                        control));
+  uint32_t const mask = uint32_t(_mm256_movemask_epi8(spaces));
+  return mask == 0xFFFFFFFF ? 32 : uint32_t(countr_zero_32(~mask));
+  FASTFLOAT_SIMD_RESTORE_WARNINGS
+}
+#endif
+
+fastfloat_really_inline __m128i simd_load16_u8(char const *p) noexcept {
+  FASTFLOAT_SIMD_DISABLE_WARNINGS
+  return _mm_loadu_si128(reinterpret_cast<__m128i const *>(p));
+  FASTFLOAT_SIMD_RESTORE_WARNINGS
+}
+
+template <typename UC>
+fastfloat_really_inline __m128i simd_load16_u8(UC const *p) noexcept {
+  return _mm_packs_epi16(simd_load8_u16(p), simd_load8_u16(p + 8));
+}
+
+template <typename UC>
+fastfloat_really_inline uint32_t simd_leading_spaces(UC const *p) noexcept {
+  FASTFLOAT_SIMD_DISABLE_WARNINGS
+  __m128i const v = simd_load16_u8(p);
+  __m128i const control = _mm_sub_epi8(v, _mm_set1_epi8(9));
+  __m128i const spaces =
+      _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(' ')),
+                   _mm_cmpeq_epi8(_mm_min_epu8(control, _mm_set1_epi8(4)),
+                                  control));
+  return uint32_t(
+      countr_zero_32(~uint32_t(_mm_movemask_epi8(spaces)) | 0x10000));
+  FASTFLOAT_SIMD_RESTORE_WARNINGS
+}
+
+#elif defined(FASTFLOAT_NEON)
+
+fastfloat_really_inline uint8x16_t simd_load16_u8(char const *p) noexcept {
+  return vld1q_u8(reinterpret_cast<uint8_t const *>(p));
+}
+
+template <typename UC>
+fastfloat_really_inline uint8x16_t simd_load16_u8(UC const *p) noexcept {
+  return vcombine_u8(vqmovn_u16(simd_load8_u16(p)),
+                     vqmovn_u16(simd_load8_u16(p + 8)));
+}
+
+template <typename UC>
+fastfloat_really_inline uint32_t simd_leading_spaces(UC const *p) noexcept {
+  FASTFLOAT_SIMD_DISABLE_WARNINGS
+  uint8x16_t const v = simd_load16_u8(p);
+  uint8x16_t const spaces =
+      vorrq_u8(vceqq_u8(v, vdupq_n_u8(' ')),
+               vcleq_u8(vsubq_u8(v, vdupq_n_u8(9)), vdupq_n_u8(4)));
+  // four bits per code unit
+  uint64_t const mask = vget_lane_u64(
+      vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(spaces), 4)), 0);
+  return mask == ~uint64_t(0) ? 16 : uint32_t(countr_zero_64(~mask) / 4);
+  FASTFLOAT_SIMD_RESTORE_WARNINGS
+}
+
+#endif // FASTFLOAT_SSE2
+
+// Skips the white space at p a block at a time, while a whole block remains.
+template <typename UC>
+fastfloat_really_inline UC const *simd_skip_space_blocks(UC const *p,
+                                                         UC const *pend) {
+  constexpr int block = simd_space_block<UC>();
+  while ((pend - p >= block) && is_space(*p)) {
+    uint32_t const n = simd_leading_spaces(p);
+    p += n;
+    if (n != uint32_t(block)) {
+      break;
+    }
+  }
+  return p;
+}
+
+fastfloat_really_inline char const *simd_skip_spaces(char const *p,
+                                                     char const *pend) {
+  return simd_skip_space_blocks(p, pend);
+}
+
+fastfloat_really_inline char16_t const *simd_skip_spaces(char16_t const *p,
+                                                         char16_t const *pend) {
+  return simd_skip_space_blocks(p, pend);
+}
+
+fastfloat_really_inline char32_t const *simd_skip_spaces(char32_t const *p,
+                                                         char32_t const *pend) {
+  return simd_skip_space_blocks(p, pend);
+}
+
+fastfloat_really_inline wchar_t const *simd_skip_spaces(wchar_t const *p,
+                                                        wchar_t const *pend) {
+  return simd_skip_space_blocks(p, pend);
+}
+
+#endif // FASTFLOAT_HAS_SIMD
+
+// dummy for compile
+template <typename UC>
+fastfloat_really_inline UC const *simd_skip_spaces(UC const *p, UC const *) {
+  return p;
+}
+
+// Returns the first code unit of [p, pend) that is not white space (see
+// is_space), or pend. A single white-space code unit, as between the numbers
+// of most inputs, is checked directly; longer runs, e.g., the padding of
+// fixed-width columns, are skipped a SIMD block at a time.
+template <typename UC>
+fastfloat_really_inline FASTFLOAT_CONSTEXPR20 UC const *
+skip_spaces(UC const *p, UC const *pend) noexcept {
+  if ((p == pend) || !is_space(*p)) {
+    return p;
+  }
+  ++p;
+  if (!cpp20_and_in_constexpr()) {
+    p = simd_skip_spaces(p, pend);
+  }
+  while ((p != pend) && is_space(*p)) {
+    ++p;
+  }
+  return p;
+}
+
+#ifdef FASTFLOAT_HAS_SIMD
+
+// The run of hexadecimal digits at the start of the 16 code units at p: returns
+// its length, and sets `digits` to the 16 code units as nibbles, the first one
+// the most significant, so that the run is the top `length` nibbles. Wider
+// code units are narrowed with saturation, which keeps them out of the run.
+template <typename UC>
+fastfloat_really_inline uint32_t simd_hex_run(UC const *p,
+                                              uint64_t &digits) noexcept {
+  FASTFLOAT_SIMD_DISABLE_WARNINGS
+#ifdef FASTFLOAT_SSE2
+  __m128i const v = simd_load16_u8(p);
+  // Unsigned comparisons: x <= 9 if min(x, 9) == x.
+  __m128i const letters =
+      _mm_sub_epi8(_mm_or_si128(v, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+  __m128i const is_letter =
+      _mm_cmpeq_epi8(_mm_min_epu8(letters, _mm_set1_epi8(5)), letters);
+  __m128i const decimal = _mm_sub_epi8(v, _mm_set1_epi8('0'));
+  __m128i const is_hex = _mm_or_si128(
+      _mm_cmpeq_epi8(_mm_min_epu8(decimal, _mm_set1_epi8(9)), decimal),
+      is_letter);
+  uint32_t const n = uint32_t(
+      countr_zero_32(~uint32_t(_mm_movemask_epi8(is_hex)) | 0x10000));
+  __m128i const nibbles =
+      _mm_add_epi8(_mm_and_si128(v, _mm_set1_epi8(0x0F)),
+                   _mm_and_si128(is_letter, _mm_set1_epi8(9)));
+  // The pairs of nibbles, the first one high, in the low byte of 16 bits.
+  __m128i const pairs = _mm_and_si128(
+      _mm_or_si128(_mm_slli_epi16(nibbles, 4), _mm_srli_epi16(nibbles, 8)),
+      _mm_set1_epi16(0x00FF));
+  __m128i const packed = _mm_packus_epi16(pairs, pairs);
+#ifdef FASTFLOAT_64BIT
+  uint64_t const bytes = uint64_t(_mm_cvtsi128_si64(packed));
+#else
+  uint64_t bytes;
+  _mm_storel_epi64(reinterpret_cast<__m128i *>(&bytes), packed);
+#endif
+#elif defined(FASTFLOAT_NEON)
+  uint8x16_t const v = simd_load16_u8(p);
+  uint8x16_t const is_letter =
+      vcleq_u8(vsubq_u8(vorrq_u8(v, vdupq_n_u8(0x20)), vdupq_n_u8('a')),
+               vdupq_n_u8(5));
+  uint8x16_t const is_hex = vorrq_u8(
+      vcleq_u8(vsubq_u8(v, vdupq_n_u8('0')), vdupq_n_u8(9)), is_letter);
+  // four bits per code unit
+  uint64_t const mask = vget_lane_u64(
+      vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(is_hex), 4)), 0);
+  uint32_t const n =
+      mask == ~uint64_t(0) ? 16 : uint32_t(countr_zero_64(~mask) / 4);
+  uint16x8_t const nibbles = vreinterpretq_u16_u8(vaddq_u8(
+      vandq_u8(v, vdupq_n_u8(0x0F)), vandq_u8(is_letter, vdupq_n_u8(9))));
+  // The pairs of nibbles, the first one high, narrowed to bytes.
+  uint8x8_t const packed = vmovn_u16(
+      vorrq_u16(vshlq_n_u16(nibbles, 4), vshrq_n_u16(nibbles, 8)));
+  uint64_t const bytes = vget_lane_u64(vreinterpret_u64_u8(packed), 0);
+#endif
+  digits = byteswap(bytes);
+  return n;
+  FASTFLOAT_SIMD_RESTORE_WARNINGS
+}
+
+fastfloat_really_inline uint32_t simd_parse_hex_run(char const *p,
+                                                    uint64_t &digits) noexcept {
+  return simd_hex_run(p, digits);
+}
+
+fastfloat_really_inline uint32_t simd_parse_hex_run(char16_t const *p,
+                                                    uint64_t &digits) noexcept {
+  return simd_hex_run(p, digits);
+}
+
+fastfloat_really_inline uint32_t simd_parse_hex_run(char32_t const *p,
+                                                    uint64_t &digits) noexcept {
+  return simd_hex_run(p, digits);
+}
+
+fastfloat_really_inline uint32_t simd_parse_hex_run(wchar_t const *p,
+                                                    uint64_t &digits) noexcept {
+  return simd_hex_run(p, digits);
+}
+
+#endif // FASTFLOAT_HAS_SIMD
+
+// dummy for compile
+template <typename UC>
+fastfloat_really_inline uint32_t simd_parse_hex_run(UC const *,
+                                                    uint64_t &) noexcept {
+  return 0;
+}
+
+// Whether simd_parse_hex_run reads UC.
+template <typename UC> constexpr bool has_simd_hex_run() {
+#ifdef FASTFLOAT_HAS_SIMD
+  return std::is_same<UC, char>::value || has_simd_opt<UC>();
+#else
+  return false;
+#endif
+}
+
+// Whether the digit loops for char parse runs of up to 16 digits at a time
+// with SSSE3 by default. The runtime dispatch (see parse_many.h) picks the
+// loops of each bulk parse instead.
+constexpr bool sixteen_digit_loops =
+#ifdef FASTFLOAT_SSSE3
+    true;
+#else
+    false;
+#endif
+
+#if defined(FASTFLOAT_SSSE3) || defined(FASTFLOAT_X86_DISPATCH)
+
+#ifdef FASTFLOAT_SSSE3
+#define FASTFLOAT_SSSE3_INLINE fastfloat_really_inline
+#define FASTFLOAT_SSSE3_ENTRY fastfloat_really_inline
+#else
+// For the runtime dispatch only: the entry point is called from generic code,
+// so it cannot be forced inline, but the compiler inlines it into the
+// dispatched functions, which target a superset of SSSE3.
+#define FASTFLOAT_SSSE3_INLINE FASTFLOAT_TARGET("ssse3") fastfloat_really_inline
+#define FASTFLOAT_SSSE3_ENTRY FASTFLOAT_TARGET("ssse3") inline
+#endif
+
+// 1e0 to 1e16
+constexpr static uint64_t simd_powers_of_ten[] = {1,
+                                                  10,
+                                                  100,
+                                                  1000,
+                                                  10000,
+                                                  100000,
+                                                  1000000,
+                                                  10000000,
+                                                  100000000,
+                                                  1000000000,
+                                                  10000000000,
+                                                  100000000000,
+                                                  1000000000000,
+                                                  10000000000000,
+                                                  100000000000000,
+                                                  1000000000000000,
+                                                  10000000000000000};
+
+// The 16 bytes at offset n are a shuffle that moves the first n bytes of a
+// vector to its end, behind 16 - n zeros.
+constexpr static uint8_t simd_shift_right_shuffle[] = {
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0,    1,    2,    3,    4,    5,
+    6,    7,    8,    9,    10,   11,   12,   13,   14,   15};
+
+// Combines 16 digits (0-9, not characters) into their value: in pairs, then
+// groups of four, then two groups of eight, with multiply-adds.
+FASTFLOAT_SSSE3_INLINE uint64_t
+simd_combine_sixteen_digits(__m128i const digits) noexcept {
+  FASTFLOAT_SIMD_DISABLE_WARNINGS
+  __m128i const pairs = _mm_maddubs_epi16(
+      digits, _mm_setr_epi8(10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1,
+                            10, 1));
+  __m128i const fours = _mm_madd_epi16(
+      pairs, _mm_setr_epi16(100, 1, 100, 1, 100, 1, 100, 1));
+  __m128i const eights =
+      _mm_madd_epi16(_mm_packs_epi32(fours, fours),
+                     _mm_setr_epi16(10000, 1, 10000, 1, 10000, 1, 10000, 1));
+#ifdef FASTFLOAT_64BIT
+  uint64_t const both = uint64_t(_mm_cvtsi128_si64(eights));
+#else
+  uint64_t both;
+  _mm_storel_epi64(reinterpret_cast<__m128i *>(&both), eights);
+#endif
+  return uint64_t(uint32_t(both)) * 100000000 + (both >> 32);
+  FASTFLOAT_SIMD_RESTORE_WARNINGS
+}
+
+// The 16 characters at p, minus '0', and the mask of those that are not
+// digits.
+FASTFLOAT_SSSE3_INLINE __m128i simd_load_digits(char const *p,
+                                                uint32_t &non_digits) noexcept {
+  FASTFLOAT_SIMD_DISABLE_WARNINGS
+  __m128i const digits =
+      _mm_sub_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const *>(p)),
+                   _mm_set1_epi8('0'));
+  __m128i const nine = _mm_set1_epi8(9);
+  non_digits = uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(
+                   _mm_max_epu8(digits, nine), nine))) ^
+               0xFFFF;
+  return digits;
+  FASTFLOAT_SIMD_RESTORE_WARNINGS
+}
+
+// Parses the run of digits before the first bit of non_digits into i (which
+// may overflow), and returns its length: the run is moved to the end of the
+// vector, behind zeros.
+FASTFLOAT_SSSE3_INLINE uint32_t simd_parse_digit_run(__m128i const digits,
+                                                     uint32_t non_digits,
+                                                     uint64_t &i) noexcept {
+  FASTFLOAT_SIMD_DISABLE_WARNINGS
+  uint32_t const n = uint32_t(countr_zero_32(non_digits));
+  __m128i const shifted = _mm_shuffle_epi8(
+      digits, _mm_loadu_si128(reinterpret_cast<__m128i const *>(
+                  simd_shift_right_shuffle + n)));
+  i = i * simd_powers_of_ten[n] + simd_combine_sixteen_digits(shifted);
+  return n;
+  FASTFLOAT_SIMD_RESTORE_WARNINGS
+}
+
+// Parses the run of digits at the start of the 16 characters at p into i
+// (which may overflow), and returns its length. The common case of 16 digits
+// returns a constant, so that the caller can advance without waiting for the
+// mask.
+FASTFLOAT_SSSE3_ENTRY uint32_t
+simd_parse_sixteen_digits(char const *p, uint64_t &i) noexcept {
+  uint32_t non_digits;
+  __m128i const digits = simd_load_digits(p, non_digits);
+  if (non_digits == 0) {
+    i = i * 10000000000000000 + simd_combine_sixteen_digits(digits);
+    return 16;
+  }
+  return simd_parse_digit_run(digits, non_digits, i);
+}
+
+#endif // FASTFLOAT_SSSE3 || FASTFLOAT_X86_DISPATCH
+
+template <bool sixteen_digits = sixteen_digit_loops, typename UC,
+          FASTFLOAT_ENABLE_IF(!std::is_same<UC, char>::value) = 0>
 fastfloat_really_inline FASTFLOAT_CONSTEXPR20 void
 loop_parse_if_eight_digits(UC const *&p, UC const *const pend, uint64_t &i) {
   if (!has_simd_opt<UC>()) {
@@ -255,9 +748,23 @@ loop_parse_if_eight_digits(UC const *&p, UC const *const pend, uint64_t &i) {
   }
 }
 
+// With sixteen_digits, the caller must target SSSE3.
+template <bool sixteen_digits = sixteen_digit_loops>
 fastfloat_really_inline FASTFLOAT_CONSTEXPR20 void
 loop_parse_if_eight_digits(char const *&p, char const *const pend,
                            uint64_t &i) {
+#if defined(FASTFLOAT_SSSE3) || defined(FASTFLOAT_X86_DISPATCH)
+  if (sixteen_digits && !cpp20_and_in_constexpr()) {
+    // A whole run of up to 16 digits at once.
+    if (pend - p >= 16) {
+      uint32_t const n = simd_parse_sixteen_digits(p, i);
+      p += n;
+      if (n != 16) {
+        return;
+      }
+    }
+  }
+#endif
   // optimizes better than parse_if_eight_digits_unrolled() for UC = char.
   while ((std::distance(p, pend) >= 8) &&
          is_made_of_eight_digits_fast(read8_to_u64(p))) {
@@ -283,6 +790,218 @@ loop_parse_if_eight_digits(char const *&p, char const *const pend,
 #endif
 }
 
+// Like loop_parse_if_eight_digits, but the input is padded (see
+// from_chars_padded): for UC = char, we read 16 (with SSSE3) or eight
+// characters at a time, even past pend, and parse the whole run of digits,
+// finding where it ends from a mask of the non-digits.
+template <typename UC>
+fastfloat_really_inline FASTFLOAT_CONSTEXPR20 void
+loop_parse_digits_padded(UC const *&p, UC const *const pend, uint64_t &i) {
+  loop_parse_if_eight_digits(p, pend, i);
+}
+
+fastfloat_really_inline FASTFLOAT_CONSTEXPR20 void
+loop_parse_digits_padded(char const *&p, char const *const pend, uint64_t &i) {
+#ifdef FASTFLOAT_SSSE3
+  if (!cpp20_and_in_constexpr()) {
+    while (pend - p >= 16) {
+      uint32_t const n = simd_parse_sixteen_digits(p, i);
+      p += n;
+      if (n != 16) {
+        return;
+      }
+    }
+    // The 16 characters at p are readable, but the run stops at pend.
+    uint32_t non_digits;
+    __m128i const digits = simd_load_digits(p, non_digits);
+    p += simd_parse_digit_run(
+        digits, non_digits | (uint32_t(1) << (pend - p)), i);
+    return;
+  }
+#endif
+  constexpr uint32_t powers_of_ten[] = {1,      10,      100,      1000,
+                                        10000,  100000,  1000000,  10000000,
+                                        100000000};
+  uint64_t val = read8_to_u64(p);
+  // The high bit of each byte that is not a digit: a carry or a borrow only
+  // crosses a byte that is not a digit, so the lowest one is exact.
+  uint64_t non_digits =
+      ((val + 0x4646464646464646) | (val - 0x3030303030303030)) &
+      0x8080808080808080;
+  while ((non_digits == 0) && (pend - p >= 8)) {
+    i = i * 100000000 + parse_eight_digits_unrolled(val);
+    p += 8;
+    val = read8_to_u64(p);
+    non_digits = ((val + 0x4646464646464646) | (val - 0x3030303030303030)) &
+                 0x8080808080808080;
+  }
+  size_t n = (non_digits == 0) ? 8 : size_t(countr_zero_64(non_digits)) >> 3;
+  size_t const left = size_t(pend - p);
+  n = (n < left) ? n : left;
+  if (n != 0) {
+    // Keep the n < 8 digits as the last ones of eight, after leading zeros.
+    unsigned const shift = unsigned(8 - n) * 8;
+    i = i * powers_of_ten[n] +
+        parse_eight_digits_unrolled((val << shift) |
+                                    (0x3030303030303030 >> (64 - shift)));
+    p += n;
+  }
+}
+
+// The run of digits at the start of the eight characters at p, or of those
+// before pend: returns its length, and sets `value` to its value. The length
+// comes from a mask of the non-digits, with no branch per digit.
+template <typename UC>
+fastfloat_really_inline FASTFLOAT_CONSTEXPR20 size_t
+parse_digit_run_in_eight(UC const *p, UC const *const pend,
+                         uint32_t &value) noexcept {
+  uint64_t val = 0;
+  if (pend - p >= 8) {
+    val = read8_to_u64(p);
+  } else {
+    // The zeros past pend are not digits.
+    for (size_t k = 0; p + k != pend; k++) {
+      val |= uint64_t(uint8_t(p[k])) << (8 * k);
+    }
+  }
+  uint64_t const non_digits =
+      ((val + 0x4646464646464646) | (val - 0x3030303030303030)) &
+      0x8080808080808080;
+  if (non_digits == 0) {
+    value = parse_eight_digits_unrolled(val);
+    return 8;
+  }
+  size_t const n = size_t(countr_zero_64(non_digits)) >> 3;
+  if (n == 0) {
+    value = 0;
+    return 0;
+  }
+  // Keep the n < 8 digits as the last ones of eight, after leading zeros.
+  unsigned const shift = unsigned(8 - n) * 8;
+  value = parse_eight_digits_unrolled((val << shift) |
+                                      (0x3030303030303030 >> (64 - shift)));
+  return n;
+}
+
+// Parses the run of digits at p into i, and moves p to its end, for the 32-
+// and 64-bit integers (MaxDigits is 10 or 20): eight digits at a time, with
+// the overflow of uint64_t checked on the last block. Returns false if the
+// run has more than MaxDigits digits or overflows.
+template <size_t MaxDigits, typename UC>
+fastfloat_really_inline FASTFLOAT_CONSTEXPR20 bool
+parse_int_digits_fixed_width(UC const *&p, UC const *const pend,
+                             uint64_t &i) noexcept {
+  static_assert(MaxDigits == 10 || MaxDigits == 20, "32- or 64-bit integers");
+  constexpr uint32_t powers_of_ten[] = {1,      10,      100,      1000,
+                                        10000,  100000,  1000000,  10000000,
+                                        100000000};
+  uint32_t block;
+  size_t n = parse_digit_run_in_eight(p, pend, block);
+  p += n;
+  i = block;
+  if (n != 8) {
+    return true;
+  }
+  FASTFLOAT_IF_CONSTEXPR17(MaxDigits == 20) {
+    n = parse_digit_run_in_eight(p, pend, block);
+    p += n;
+    if (n != 8) {
+      i = i * powers_of_ten[n] + block;
+      return true;
+    }
+    i = i * 100000000 + block;
+  }
+  // The last two or four digits at most, one at a time: the 20th can overflow.
+  for (size_t k = (MaxDigits == 10) ? 8 : 16; k != MaxDigits; k++) {
+    if ((p == pend) || !is_integer(*p)) {
+      return true;
+    }
+    uint64_t const digit = uint64_t(*p - UC('0'));
+    if ((k == 19) && ((i > 1844674407370955161) ||
+                      (i * 10 > 0xFFFFFFFFFFFFFFFF - digit))) {
+      break;
+    }
+    i = i * 10 + digit;
+    ++p;
+  }
+  if ((p == pend) || !is_integer(*p)) {
+    return true;
+  }
+  while ((p != pend) && is_integer(*p)) {
+    ++p;
+  }
+  return false;
+}
+
+// Whether a group of `group` digits, which ends at a separator (or at the end
+// of the part if `last`), has the size of the options: see parse_options_t.
+fastfloat_really_inline constexpr bool
+digit_group_fits(int64_t group, int group_size, bool fraction, bool separated,
+                 bool last) noexcept {
+  return (group_size == 0) || (last && !separated) ||
+         ((fraction ? last : !separated) ? group <= group_size
+                                         : group == group_size);
+}
+
+// Parses the digits at p, in `base`, with the digit separators of `options`
+// between them, into i (which wraps around as with the other digit loops, and
+// then sets `overflow`), and moves p to their end; `digits` counts them. A
+// separator that is not between two digits is not read. Returns false if the
+// groups of the part (the fraction if `fraction` is set, or the integer part)
+// do not have the size of the options.
+//
+// For char in base 10, a run of digits that starts the part is parsed eight
+// at a time. Once there are separators, the digits are read one at a time:
+// with groups of three or four digits, removing the separators from a word
+// costs more than it saves.
+template <typename UC, typename Options>
+fastfloat_really_inline FASTFLOAT_CONSTEXPR20 bool
+parse_separated_digits(UC const *&p, UC const *const pend,
+                       Options const &options, int base, bool fraction,
+                       uint64_t &i, int64_t &digits, bool &overflow) noexcept {
+  UC const separator = options.digit_separator;
+  int const group_size = options.digit_group_size;
+  // The digits of the current group: the last character read is a digit if
+  // it is not zero.
+  int64_t group = 0;
+  bool separated = false;
+  FASTFLOAT_IF_CONSTEXPR17((std::is_same<UC, char>::value)) {
+    if (base == 10) {
+      while ((pend - p >= 8) &&
+             is_made_of_eight_digits_fast(read8_to_u64(p))) {
+        uint32_t const value = parse_eight_digits_unrolled(read8_to_u64(p));
+        value128 const product = full_multiplication(i, 100000000);
+        i = product.low + value;
+        overflow |= (product.high != 0) || (i < value);
+        group += 8;
+        p += 8;
+      }
+      digits += group;
+    }
+  }
+  while (p != pend) {
+    uint8_t const digit = ch_to_digit(*p);
+    if (digit < base) {
+      value128 const product = full_multiplication(i, uint64_t(base));
+      i = product.low + digit;
+      overflow |= (product.high != 0) || (i < digit);
+      ++digits;
+      ++group;
+    } else if ((*p == separator) && (group != 0) && (pend - p >= 2) &&
+               (ch_to_digit(p[1]) < base)) {
+      if (!digit_group_fits(group, group_size, fraction, separated, false)) {
+        return false;
+      }
+      group = 0;
+      separated = true;
+    } else {
+      break;
+    }
+    ++p;
+  }
+  return digit_group_fits(group, group_size, fraction, separated, true);
+}
+
 enum class parse_error {
   no_error,
   // [JSON-only] The minus sign must be followed by an integer.
@@ -300,6 +1019,9 @@ enum class parse_error {
   no_digits_in_mantissa,
   // Scientific notation requires an exponential part.
   missing_exponential_part,
+  // The groups of digits between digit separators do not have the size of
+  // the options.
+  invalid_digit_grouping,
 };
 
 template <typename UC> struct parsed_number_string_t {
@@ -335,12 +1057,46 @@ report_parse_error(UC const *p, parse_error error) {
 // template would create a second instantiation of this whole function and the
 // extra icache pressure wipes out the gain). When false, the integer/fraction
 // spans (read only by the rare digit_comp slow path) are not materialized,
-// which keeps the fat parsed_number_string_t off the hot path. The caller
-// re-parses with store_spans=true if the slow path is actually reached.
-template <bool basic_json_fmt, typename UC>
+// which keeps the fat parsed_number_string_t off the hot path, except with too
+// many digits, where they are always set along with the truncated mantissa.
+// The caller re-parses with store_spans=true if digit_comp is needed otherwise.
+//
+// sixteen_digits selects the digit loops (see loop_parse_if_eight_digits): only
+// the runtime dispatch of the bulk parse sets it explicitly.
+//
+// Options is parse_options_t<UC>, or detail::constant_parse_options when the
+// options are template arguments.
+//
+// With a digit separator in the options, the spans include the separators,
+// and parse_separated_number_string does the parse: the digits are read with
+// parse_separated_digits.
+template <bool basic_json_fmt, typename UC, typename Options>
+FASTFLOAT_CONSTEXPR20 parsed_number_string_t<UC>
+parse_separated_number_string(UC const *p, UC const *pend, Options options,
+                              bool store_spans) noexcept;
+
+template <bool basic_json_fmt, typename UC,
+          bool sixteen_digits = sixteen_digit_loops,
+          typename Options = parse_options_t<UC>, bool separated = false>
 fastfloat_really_inline FASTFLOAT_CONSTEXPR20 parsed_number_string_t<UC>
-parse_number_string(UC const *p, UC const *pend, parse_options_t<UC> options,
+parse_number_string(UC const *p, UC const *pend, Options options,
                     bool store_spans = true) noexcept {
+// See from_chars_float_prepared about -Wc++20-extensions.
+#ifdef __clang__
+#pragma clang diagnostic push
+#if (!defined(__APPLE_CC__) && __clang_major__ >= 10) || (__clang_major__ >= 13)
+#pragma clang diagnostic ignored "-Wc++20-extensions"
+#endif
+#endif
+  FASTFLOAT_IF_CONSTEXPR17(!separated) {
+    if fastfloat_unlikely (options.digit_separator != UC(0)) {
+      return parse_separated_number_string<basic_json_fmt>(p, pend, options,
+                                                           store_spans);
+    }
+  }
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
   chars_format const fmt = detail::adjust_for_feature_macros(options.format);
   UC const decimal_point = options.decimal_point;
 
@@ -375,12 +1131,21 @@ parse_number_string(UC const *p, UC const *pend, parse_options_t<UC> options,
   UC const *const start_digits = p;
 
   uint64_t i = 0; // an unsigned int avoids signed overflows (which are bad)
-
+  int64_t digit_count = 0;
+  // Unused: the number of digits decides.
+  bool overflow = false;
+
+  FASTFLOAT_IF_CONSTEXPR17(separated) {
+    if (!parse_separated_digits(p, pend, options, 10, false, i, digit_count,
+                                overflow)) {
+      return report_parse_error<UC>(p, parse_error::invalid_digit_grouping);
+    }
+  }
   // Straight-line unroll of the integer-part scan: most integer parts are
   // 1-5 digits, so peeling the first iterations eliminates the loop back-edge
   // for the common case. Semantics are identical to the original `while` loop:
   // i = 10*i + digit, advancing p.
-  if ((p != pend) && is_integer(*p)) {
+  else if ((p != pend) && is_integer(*p)) {
     i = uint64_t(*p - UC('0'));
     ++p;
     if ((p != pend) && is_integer(*p)) {
@@ -408,7 +1173,10 @@ parse_number_string(UC const *p, UC const *pend, parse_options_t<UC> options,
     }
   }
   UC const *const end_of_integer_part = p;
-  int64_t digit_count = int64_t(end_of_integer_part - start_digits);
+  FASTFLOAT_IF_CONSTEXPR17(!separated) {
+    digit_count = int64_t(end_of_integer_part - start_digits);
+  }
+  int64_t const integer_digit_count = digit_count;
   if (store_spans) {
     answer.integer = span<UC const>(start_digits, size_t(digit_count));
   }
@@ -424,20 +1192,32 @@ parse_number_string(UC const *p, UC const *pend, parse_options_t<UC> options,
   }
 
   int64_t exponent = 0;
+  UC const *end_of_fraction = p;
   bool const has_decimal_point = (p != pend) && (*p == decimal_point);
   if (has_decimal_point) {
     ++p;
     UC const *before = p;
-    // can occur at most twice without overflowing, but let it occur more, since
-    // for integers with many digits, digit parsing is the primary bottleneck.
-    loop_parse_if_eight_digits(p, pend, i);
+    FASTFLOAT_IF_CONSTEXPR17(separated) {
+      if (!parse_separated_digits(p, pend, options, 10, true, i, exponent,
+                                  overflow)) {
+        return report_parse_error<UC>(p, parse_error::invalid_digit_grouping);
+      }
+      exponent = -exponent;
+    }
+    else {
+      // can occur at most twice without overflowing, but let it occur more,
+      // since for integers with many digits, digit parsing is the primary
+      // bottleneck.
+      loop_parse_if_eight_digits<sixteen_digits>(p, pend, i);
 
-    while ((p != pend) && is_integer(*p)) {
-      uint8_t digit = uint8_t(*p - UC('0'));
-      ++p;
-      i = i * 10 + digit; // in rare cases, this will overflow, but that's ok
+      while ((p != pend) && is_integer(*p)) {
+        uint8_t digit = uint8_t(*p - UC('0'));
+        ++p;
+        i = i * 10 + digit; // in rare cases, this will overflow, but that's ok
+      }
+      exponent = before - p;
     }
-    exponent = before - p;
+    end_of_fraction = p;
     if (store_spans) {
       answer.fraction = span<UC const>(before, size_t(p - before));
     }
@@ -516,7 +1296,9 @@ parse_number_string(UC const *p, UC const *pend, parse_options_t<UC> options,
     // We need to be mindful of the case where we only have zeroes...
     // E.g., 0.000000000...000.
     UC const *start = start_digits;
-    while ((start != pend) && (*start == UC('0') || *start == decimal_point)) {
+    while ((start != pend) &&
+           (*start == UC('0') || *start == decimal_point ||
+            (separated && (*start == options.digit_separator)))) {
       if (*start == UC('0')) {
         digit_count--;
       }
@@ -525,35 +1307,48 @@ parse_number_string(UC const *p, UC const *pend, parse_options_t<UC> options,
 
     if (digit_count > 19) {
       answer.too_many_digits = true;
-      // The truncation recompute below reads the integer/fraction spans. When
-      // store_spans is false we didn't materialize them, so just flag
-      // too_many_digits; the caller re-parses with store_spans=true to obtain
-      // the corrected mantissa/exponent before taking the slow path.
-      if (store_spans) {
-        // Let us start again, this time, avoiding overflows.
-        // We don't need to call if is_integer, since we use the
-        // pre-tokenized spans from above.
-        i = 0;
-        p = answer.integer.ptr;
-        UC const *int_end = p + answer.integer.len();
-        uint64_t const minimal_nineteen_digit_integer{1000000000000000000};
-        while ((i < minimal_nineteen_digit_integer) && (p != int_end)) {
+      // Keep the first 19 significant digits, with the exponent adjusted
+      // accordingly. This only reads these digits again, from the bounds we
+      // already know, and it also materializes the spans for digit_comp, so
+      // that the caller never parses the number a second time.
+      answer.integer = span<UC const>(
+          start_digits, size_t(end_of_integer_part - start_digits));
+      if (has_decimal_point) {
+        answer.fraction = span<UC const>(
+            end_of_integer_part + 1,
+            size_t(end_of_fraction - (end_of_integer_part + 1)));
+      }
+      // Let us start again, this time, avoiding overflows.
+      // We don't need to call if is_integer, since we use the
+      // pre-tokenized spans from above.
+      i = 0;
+      p = answer.integer.ptr;
+      UC const *int_end = p + answer.integer.len();
+      uint64_t const minimal_nineteen_digit_integer{1000000000000000000};
+      int64_t integer_digits = 0;
+      while ((i < minimal_nineteen_digit_integer) && (p != int_end)) {
+        if (!separated || (*p != options.digit_separator)) {
           i = i * 10 + uint64_t(*p - UC('0'));
-          ++p;
+          ++integer_digits;
         }
-        if (i >= minimal_nineteen_digit_integer) { // We have a big integer
-          exponent = end_of_integer_part - p + exp_number;
-        } else { // We have a value with a fractional component.
-          p = answer.fraction.ptr;
-          UC const *frac_end = p + answer.fraction.len();
-          while ((i < minimal_nineteen_digit_integer) && (p != frac_end)) {
+        ++p;
+      }
+      if (i >= minimal_nineteen_digit_integer) { // We have a big integer
+        exponent = integer_digit_count - integer_digits + exp_number;
+      } else { // We have a value with a fractional component.
+        p = answer.fraction.ptr;
+        UC const *frac_end = p + answer.fraction.len();
+        int64_t fraction_digits = 0;
+        while ((i < minimal_nineteen_digit_integer) && (p != frac_end)) {
+          if (!separated || (*p != options.digit_separator)) {
             i = i * 10 + uint64_t(*p - UC('0'));
-            ++p;
+            ++fraction_digits;
           }
-          exponent = answer.fraction.ptr - p + exp_number;
+          ++p;
         }
-        // We have now corrected both exponent and i, to a truncated value
+        exponent = exp_number - fraction_digits;
       }
+      // We have now corrected both exponent and i, to a truncated value
     }
   }
   answer.exponent = exponent;
@@ -561,10 +1356,441 @@ parse_number_string(UC const *p, UC const *pend, parse_options_t<UC> options,
   return answer;
 }
 
-template <typename T, typename UC>
+template <bool basic_json_fmt, typename UC, typename Options>
+FASTFLOAT_CONSTEXPR20 parsed_number_string_t<UC>
+parse_separated_number_string(UC const *p, UC const *pend, Options options,
+                              bool store_spans) noexcept {
+  return parse_number_string<basic_json_fmt, UC, sixteen_digit_loops, Options,
+                             true>(p, pend, options, store_spans);
+}
+
+template <typename UC> struct parsed_hex_string_t {
+  // The first 16 significant hexadecimal digits
+  uint64_t mantissa{0};
+  // The value is mantissa * 2^exponent, if not inexact.
+  int64_t exponent{0};
+  UC const *lastmatch{nullptr};
+  bool negative{false};
+  bool valid{false};
+  // Whether some of the digits after the first 16 significant ones are not 0
+  bool inexact{false};
+};
+
+// Parses the hexadecimal digits at p: the first 16 significant ones go to the
+// mantissa (digits counts them) and the next ones are dropped.
+template <typename UC>
+fastfloat_really_inline FASTFLOAT_CONSTEXPR20 void
+parse_hex_digits(UC const *&p, UC const *const pend, uint64_t &mantissa,
+                 int &digits, int64_t &dropped, bool &inexact) noexcept {
+  if (mantissa == 0) {
+    // The leading zeros, so that the digits of the SWAR steps are significant.
+    while ((p != pend) && (*p == UC('0'))) {
+      ++p;
+    }
+  }
+  // Up to eight digits at a time, with SWAR: char is read as is, and the wider
+  // code units are narrowed with saturation, which keeps them out of the
+  // digits.
+  bool const swar = std::is_same<UC, char>::value ||
+                    (!cpp20_and_in_constexpr() && has_simd_opt<UC>());
+  while (swar && (pend - p >= 8)) {
+    uint64_t const val = std::is_same<UC, char>::value ? read8_to_u64(p)
+                                                      : simd_read8_to_u64(p);
+    uint64_t const non_hex = non_hex_digits_in_eight(val);
+    size_t const n =
+        (non_hex == 0) ? 8 : size_t(countr_zero_64(non_hex)) >> 3;
+    if ((n == 0) || (size_t(digits) + n > 16)) {
+      break;
+    }
+    mantissa = (mantissa << (4 * n)) | parse_hex_digits_unrolled(val, n);
+    digits += int(n);
+    p += n;
+    if (n < 8) {
+      return;
+    }
+  }
+  while (p != pend) {
+    uint8_t const digit = ch_to_digit(*p);
+    if (digit >= 16) {
+      break;
+    }
+    if (digits < 16) {
+      mantissa = (mantissa << 4) | digit;
+      ++digits;
+    } else {
+      ++dropped;
+      inexact |= (digit != 0);
+    }
+    ++p;
+  }
+}
+
+// Parses a hexadecimal floating-point number, as std::from_chars does with
+// chars_format::hex: [sign] digits [decimal point [digits]] [p [sign] digits],
+// with a digit at least. With `prefixed`, "0x" or "0X" must follow the sign.
+template <typename UC, typename Options>
+fastfloat_really_inline FASTFLOAT_CONSTEXPR20 parsed_hex_string_t<UC>
+parse_hex_number_string(UC const *p, UC const *pend, Options options,
+                        bool prefixed) noexcept {
+  parsed_hex_string_t<UC> answer;
+  // assume p < pend, so dereference without checks;
+  answer.negative = (*p == UC('-'));
+  if ((*p == UC('-')) ||
+      (uint64_t(options.format & chars_format::allow_leading_plus) &&
+       (*p == UC('+')))) {
+    ++p;
+  }
+  if (prefixed) {
+    if ((pend - p < 2) || (p[0] != UC('0')) ||
+        ((p[1] != UC('x')) && (p[1] != UC('X')))) {
+      return answer;
+    }
+    p += 2;
+  }
+  uint64_t mantissa = 0;
+  int digits = 0;
+  int64_t dropped = 0;
+  bool inexact = false;
+  UC const *const start_digits = p;
+  // The integer part of the normalized numbers of printf("%a") is a single
+  // digit, which needs no SWAR step.
+  if ((pend - p >= 2) && (ch_to_digit(p[0]) < 16) &&
+      (ch_to_digit(p[1]) >= 16)) {
+    mantissa = ch_to_digit(p[0]);
+    digits = int(mantissa != 0);
+    ++p;
+  } else {
+    parse_hex_digits(p, pend, mantissa, digits, dropped, inexact);
+  }
+  bool has_digits = (p != start_digits);
+  int64_t exponent = 0;
+  if ((p != pend) && (*p == options.decimal_point)) {
+    ++p;
+    UC const *const before = p;
+    parse_hex_digits(p, pend, mantissa, digits, dropped, inexact);
+    exponent = -4 * int64_t(p - before);
+    has_digits |= (p != before);
+  }
+  if (!has_digits) {
+    return answer;
+  }
+  exponent += 4 * dropped;
+  if ((p != pend) && ((*p == UC('p')) || (*p == UC('P')))) {
+    UC const *const location_of_p = p;
+    ++p;
+    bool neg_exp = false;
+    if ((p != pend) && (UC('-') == *p)) {
+      neg_exp = true;
+      ++p;
+    } else if ((p != pend) && (UC('+') == *p)) {
+      ++p;
+    }
+    if ((p == pend) || !is_integer(*p)) {
+      // Not an exponent: the number ends before the 'p'.
+      p = location_of_p;
+    } else {
+      int64_t exp_number = 0;
+      while ((p != pend) && is_integer(*p)) {
+        uint8_t const digit = uint8_t(*p - UC('0'));
+        if (exp_number < 0x10000000) {
+          exp_number = 10 * exp_number + digit;
+        }
+        ++p;
+      }
+      exponent += neg_exp ? -exp_number : exp_number;
+    }
+  }
+  answer.mantissa = mantissa;
+  answer.exponent = exponent;
+  answer.lastmatch = p;
+  answer.valid = true;
+  answer.inexact = inexact;
+  return answer;
+}
+
+// Parses the digits of base 2, 8 or 16 at p into i (which may overflow), up to
+// eight at a time with SWAR, as parse_hex_digits does: the digits are
+// accumulated with shifts rather than multiplications, sixteen hexadecimal
+// digits at a time with SIMD.
+template <typename UC>
+fastfloat_really_inline FASTFLOAT_CONSTEXPR20 void
+loop_parse_pow2_digits(UC const *&p, UC const *const pend, uint64_t &i,
+                       int base) noexcept {
+  int const bits = (base == 16) ? 4 : (base == 8) ? 3 : 1;
+  if (has_simd_hex_run<UC>() && (base == 16) && !cpp20_and_in_constexpr()) {
+    // Sixteen hexadecimal digits at a time with SIMD.
+    while (pend - p >= 16) {
+      uint64_t digits;
+      uint32_t const n = simd_parse_hex_run(p, digits);
+      if (n == 16) {
+        i = digits; // the previous digits overflow
+        p += 16;
+        continue;
+      }
+      if (n != 0) {
+        i = (i << (4 * n)) | (digits >> (64 - 4 * n));
+        p += n;
+      }
+      return;
+    }
+  }
+  bool const swar = std::is_same<UC, char>::value ||
+                    (!cpp20_and_in_constexpr() && has_simd_opt<UC>());
+  while (swar && (pend - p >= 8)) {
+    uint64_t val = std::is_same<UC, char>::value ? read8_to_u64(p)
+                                                : simd_read8_to_u64(p);
+    // The high bit of each byte that is not a digit: a carry or a borrow only
+    // crosses a byte that is not a digit, so the lowest one is exact.
+    uint64_t non_digits;
+    if (base == 16) {
+      non_digits = non_hex_digits_in_eight(val);
+      val = (val & 0x0F0F0F0F0F0F0F0F) + (hex_letters_in_eight(val) >> 7) * 9;
+    } else {
+      non_digits = ((val + ((base == 8) ? 0x4848484848484848
+                                         : 0x4E4E4E4E4E4E4E4E)) |
+                    (val - 0x3030303030303030)) &
+                   0x8080808080808080;
+      val -= 0x3030303030303030;
+    }
+    if (non_digits == 0) {
+      // Advancing by a constant lets the next load start early.
+      i = (i << (8 * bits)) | combine_pow2_digits(val, 8, bits);
+      p += 8;
+      continue;
+    }
+    size_t const n = size_t(countr_zero_64(non_digits)) >> 3;
+    if (n != 0) {
+      i = (i << (size_t(bits) * n)) | combine_pow2_digits(val, n, bits);
+      p += n;
+    }
+    return;
+  }
+  while (p != pend) {
+    uint8_t const digit = ch_to_digit(*p);
+    if (digit >= base) {
+      break;
+    }
+    i = (i << bits) | digit;
+    ++p;
+  }
+}
+
+#ifdef FASTFLOAT_HAS_INT128
+
+// Parses the run of at most 19 digits at p into v, eight at a time where
+// possible, and returns its length.
+template <typename UC>
+fastfloat_really_inline FASTFLOAT_CONSTEXPR20 size_t
+parse_nineteen_digits(UC const *&p, UC const *const pend,
+                      uint64_t &v) noexcept {
+  UC const *const start = p;
+  v = 0;
+  FASTFLOAT_IF_CONSTEXPR17(sizeof(UC) == 1) {
+    // A short run from a mask, as in parse_int_digits_fixed_width.
+    uint32_t block;
+    size_t const n = parse_digit_run_in_eight(p, pend, block);
+    p += n;
+    v = block;
+    if (n != 8) {
+      return n;
+    }
+    if ((pend - p >= 8) && is_made_of_eight_digits_fast(read8_to_u64(p))) {
+      v = v * 100000000 + parse_eight_digits_unrolled(read8_to_u64(p));
+      p += 8;
+    }
+  }
+  else {
+    for (int k = 0; (k != 2) && has_simd_opt<UC>() && (pend - p >= 8); k++) {
+      if (!simd_parse_if_eight_digits_unrolled(p, v)) {
+        break;
+      }
+      p += 8;
+    }
+  }
+  while ((p != pend) && (p - start != 19) && is_integer(*p)) {
+    v = v * 10 + uint64_t(*p - UC('0'));
+    ++p;
+  }
+  return size_t(p - start);
+}
+
+// Parses the run of at most `count` digits of base `base` at p into v, sets
+// `power` to base to the power of its length, and returns that length.
+template <typename UC>
+fastfloat_really_inline FASTFLOAT_CONSTEXPR20 size_t
+parse_digit_chunk(UC const *&p, UC const *const pend, int base, size_t count,
+                  uint64_t &v, uint64_t &power) noexcept {
+  constexpr uint64_t powers_of_ten[] = {1,
+                                        10,
+                                        100,
+                                        1000,
+                                        10000,
+                                        100000,
+                                        1000000,
+                                        10000000,
+                                        100000000,
+                                        1000000000,
+                                        10000000000,
+                                        100000000000,
+                                        1000000000000,
+                                        10000000000000,
+                                        100000000000000,
+                                        1000000000000000,
+                                        10000000000000000,
+                                        100000000000000000,
+                                        1000000000000000000,
+                                        10000000000000000000u};
+  if (base == 10) {
+    size_t const n = parse_nineteen_digits(p, pend, v);
+    power = powers_of_ten[n];
+    return n;
+  }
+  UC const *const start = p;
+  v = 0;
+  power = 1;
+  while ((p != pend) && (size_t(p - start) != count)) {
+    uint8_t const digit = ch_to_digit(*p);
+    if (digit >= base) {
+      break;
+    }
+    v = v * uint64_t(base) + digit;
+    power *= uint64_t(base);
+    ++p;
+  }
+  return size_t(p - start);
+}
+
+// Sets i to i * m + a, and returns false if it overflows.
+fastfloat_really_inline FASTFLOAT_CONSTEXPR14 bool
+multiply_add_u128(__uint128_t &i, uint64_t m, uint64_t a) noexcept {
+  __uint128_t const low = __uint128_t(uint64_t(i)) * m;
+  __uint128_t const high = __uint128_t(uint64_t(i >> 64)) * m;
+  if ((high >> 64) != 0) {
+    return false;
+  }
+  __uint128_t const product = low + (high << 64);
+  if (product < low) {
+    return false;
+  }
+  i = product + a;
+  return i >= product;
+}
+
+// Parses the run of digits of base `base` at p into i, and moves p to its
+// end, for the 128-bit integers. The digits come in chunks that fit in 64
+// bits (of 19 digits in base 10, parsed eight at a time): the first two are
+// combined with one 64-bit by 64-bit multiplication, which cannot overflow,
+// and the next ones with a checked one. Returns false if the run overflows.
+template <typename UC>
+fastfloat_really_inline FASTFLOAT_CONSTEXPR20 bool
+parse_int128_digits(UC const *&p, UC const *const pend, __uint128_t &i,
+                    int base) noexcept {
+  size_t const count = max_digits_u64(base) - 1;
+  uint64_t high;
+  uint64_t power;
+  size_t n = parse_digit_chunk(p, pend, base, count, high, power);
+  i = high;
+  if (n != count) {
+    return true;
+  }
+  uint64_t low;
+  n = parse_digit_chunk(p, pend, base, count, low, power);
+  i = __uint128_t(high) * power + low;
+  bool in_range = true;
+  while (n == count) {
+    n = parse_digit_chunk(p, pend, base, count, low, power);
+    if (n == 0) {
+      break;
+    }
+    in_range = multiply_add_u128(i, power, low) && in_range;
+  }
+  return in_range;
+}
+
+#endif // FASTFLOAT_HAS_INT128
+
+// The integer of magnitude i (in range), negated if `negative`.
+template <typename T, typename U>
+fastfloat_really_inline FASTFLOAT_CONSTEXPR14 T
+integer_from_magnitude(U i, bool negative) noexcept {
+  if (negative) {
+#ifdef FASTFLOAT_VISUAL_STUDIO
+#pragma warning(push)
+#pragma warning(disable : 4146)
+#endif
+    // this weird workaround is required because:
+    // - converting unsigned to signed when its value is greater than signed max
+    // is UB pre-C++23.
+    // - reinterpret_casting (~i + 1) would work, but it is not constexpr
+    // this is always optimized into a neg instruction (note: T is an integer
+    // type)
+    return T(-std::numeric_limits<T>::max() -
+             T(i - U(std::numeric_limits<T>::max())));
+#ifdef FASTFLOAT_VISUAL_STUDIO
+#pragma warning(pop)
+#endif
+  }
+  return T(i);
+}
+
+// parse_int_string with a digit separator in the options, from the first
+// digit at p: the digits are read with parse_separated_digits.
+template <typename T, typename UC, typename Options>
+FASTFLOAT_CONSTEXPR20 from_chars_result_t<UC>
+parse_separated_int_string(UC const *first, UC const *p, UC const *pend,
+                           T &value, Options options, bool negative) noexcept {
+  from_chars_result_t<UC> answer;
+  UC const *const start_digits = p;
+  uint64_t i = 0;
+  int64_t digits = 0;
+  bool overflow = false;
+  if (!parse_separated_digits(p, pend, options, options.base, false, i, digits,
+                              overflow) ||
+      (digits == 0)) {
+    answer.ec = std::errc::invalid_argument;
+    answer.ptr = first;
+    return answer;
+  }
+  answer.ptr = p;
+#ifdef FASTFLOAT_HAS_INT128
+  FASTFLOAT_IF_CONSTEXPR17(sizeof(T) == 16) {
+    // The digits again, in 128 bits.
+    __uint128_t wide = 0;
+    bool in_range = true;
+    for (UC const *q = start_digits; q != p; ++q) {
+      if (*q != options.digit_separator) {
+        in_range = multiply_add_u128(wide, uint64_t(options.base),
+                                     ch_to_digit(*q)) &&
+                   in_range;
+      }
+    }
+    if (!in_range || (wide > __uint128_t(std::numeric_limits<T>::max()) +
+                                 __uint128_t(negative))) {
+      answer.ec = std::errc::result_out_of_range;
+      return answer;
+    }
+    value = integer_from_magnitude<T>(wide, negative);
+    answer.ec = std::errc();
+    return answer;
+  }
+#else
+  (void)start_digits;
+#endif
+  if (overflow ||
+      (i > uint64_t(std::numeric_limits<T>::max()) + uint64_t(negative))) {
+    answer.ec = std::errc::result_out_of_range;
+    return answer;
+  }
+  value = integer_from_magnitude<T>(i, negative);
+  answer.ec = std::errc();
+  return answer;
+}
+
+template <typename T, typename UC, bool padded = false,
+          bool sixteen_digits = sixteen_digit_loops,
+          typename Options = parse_options_t<UC>>
 fastfloat_really_inline FASTFLOAT_CONSTEXPR20 from_chars_result_t<UC>
-parse_int_string(UC const *p, UC const *pend, T &value,
-                 parse_options_t<UC> options) {
+parse_int_string(UC const *p, UC const *pend, T &value, Options options) {
   chars_format const fmt = detail::adjust_for_feature_macros(options.format);
   int const base = options.base;
 
@@ -577,7 +1803,7 @@ parse_int_string(UC const *p, UC const *pend, T &value,
 #pragma warning(push)
 #pragma warning(disable : 4127)
 #endif
-  if (!std::is_signed<T>::value && negative) {
+  if (!std::numeric_limits<T>::is_signed && negative) {
 #ifdef FASTFLOAT_VISUAL_STUDIO
 #pragma warning(pop)
 #endif
@@ -590,6 +1816,21 @@ parse_int_string(UC const *p, UC const *pend, T &value,
     ++p;
   }
 
+// See from_chars_float_prepared about -Wc++20-extensions.
+#ifdef __clang__
+#pragma clang diagnostic push
+#if (!defined(__APPLE_CC__) && __clang_major__ >= 10) || (__clang_major__ >= 13)
+#pragma clang diagnostic ignored "-Wc++20-extensions"
+#endif
+#endif
+  if fastfloat_unlikely (options.digit_separator != UC(0)) {
+    return parse_separated_int_string(first, p, pend, value, options,
+                                      negative);
+  }
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+
   UC const *const start_num = p;
 
   while (p != pend && *p == UC('0')) {
@@ -600,6 +1841,33 @@ parse_int_string(UC const *p, UC const *pend, T &value,
 
   UC const *const start_digits = p;
 
+#ifdef FASTFLOAT_HAS_INT128
+  FASTFLOAT_IF_CONSTEXPR17(sizeof(T) == 16) {
+    __uint128_t i;
+    bool const in_range = parse_int128_digits(p, pend, i, base);
+    if (p == start_digits) {
+      if (has_leading_zeros) {
+        value = 0;
+        answer.ec = std::errc();
+        answer.ptr = p;
+      } else {
+        answer.ec = std::errc::invalid_argument;
+        answer.ptr = first;
+      }
+      return answer;
+    }
+    answer.ptr = p;
+    if (!in_range || (i > __uint128_t(std::numeric_limits<T>::max()) +
+                              __uint128_t(negative))) {
+      answer.ec = std::errc::result_out_of_range;
+      return answer;
+    }
+    value = integer_from_magnitude<T>(i, negative);
+    answer.ec = std::errc();
+    return answer;
+  }
+#endif
+
   FASTFLOAT_IF_CONSTEXPR17(
       (std::is_same<T, std::uint8_t>::value && sizeof(UC) == 1)) {
     if (base == 10) {
@@ -744,9 +2012,46 @@ parse_int_string(UC const *p, UC const *pend, T &value,
     }
   }
 
+  // The 32- and 64-bit integers: the runs of digits are parsed eight at a
+  // time, with no branch per digit, and checked against the type directly.
+  FASTFLOAT_IF_CONSTEXPR17(((sizeof(T) == 4) || (sizeof(T) == 8)) &&
+                           (sizeof(UC) == 1) && !padded) {
+    if (base == 10) {
+      uint64_t i;
+      bool const in_range =
+          parse_int_digits_fixed_width<(sizeof(T) == 4) ? 10 : 20>(p, pend, i);
+      if (p == start_digits) {
+        if (has_leading_zeros) {
+          value = 0;
+          answer.ec = std::errc();
+          answer.ptr = p;
+        } else {
+          answer.ec = std::errc::invalid_argument;
+          answer.ptr = first;
+        }
+        return answer;
+      }
+      answer.ptr = p;
+      if (!in_range ||
+          (i > uint64_t(std::numeric_limits<T>::max()) + uint64_t(negative))) {
+        answer.ec = std::errc::result_out_of_range;
+        return answer;
+      }
+      value = integer_from_magnitude<T>(i, negative);
+      answer.ec = std::errc();
+      return answer;
+    }
+  }
+
   uint64_t i = 0;
   if (base == 10) {
-    loop_parse_if_eight_digits(p, pend, i); // use SIMD if possible
+    FASTFLOAT_IF_CONSTEXPR17(padded) { loop_parse_digits_padded(p, pend, i); }
+    else {
+      // use SIMD if possible
+      loop_parse_if_eight_digits<sixteen_digits>(p, pend, i);
+    }
+  } else if ((base == 16) || (base == 8) || (base == 2)) {
+    loop_parse_pow2_digits(p, pend, i, base);
   }
   while (p != pend) {
     uint8_t digit = ch_to_digit(*p);
@@ -781,7 +2086,11 @@ parse_int_string(UC const *p, UC const *pend, T &value,
   }
   // this check can be eliminated for all other types, but they will all require
   // a max_digits(base) equivalent
-  if (digit_count == max_digits && i < min_safe_u64(base)) {
+  // A leading digit up to max_leading_digit_u64() wraps i around once at most,
+  // and then below min_safe_u64().
+  if (digit_count == max_digits &&
+      (i < min_safe_u64(base) ||
+       ch_to_digit(*start_digits) > max_leading_digit_u64(base))) {
     answer.ec = std::errc::result_out_of_range;
     return answer;
   }
@@ -794,26 +2103,7 @@ parse_int_string(UC const *p, UC const *pend, T &value,
     }
   }
 
-  if (negative) {
-#ifdef FASTFLOAT_VISUAL_STUDIO
-#pragma warning(push)
-#pragma warning(disable : 4146)
-#endif
-    // this weird workaround is required because:
-    // - converting unsigned to signed when its value is greater than signed max
-    // is UB pre-C++23.
-    // - reinterpret_casting (~i + 1) would work, but it is not constexpr
-    // this is always optimized into a neg instruction (note: T is an integer
-    // type)
-    value = T(-std::numeric_limits<T>::max() -
-              T(i - uint64_t(std::numeric_limits<T>::max())));
-#ifdef FASTFLOAT_VISUAL_STUDIO
-#pragma warning(pop)
-#endif
-  } else {
-    value = T(i);
-  }
-
+  value = integer_from_magnitude<T>(i, negative);
   answer.ec = std::errc();
   return answer;
 }
@@ -0,0 +1,126 @@
+#ifndef FASTFLOAT_CPU_DISPATCH_H
+#define FASTFLOAT_CPU_DISPATCH_H
+
+#include "float_common.h"
+
+#ifdef FASTFLOAT_RUNTIME_DISPATCH
+
+#include <atomic>
+#include <cstdint>
+
+#ifdef FASTFLOAT_X86_DISPATCH
+#ifdef FASTFLOAT_VISUAL_STUDIO
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+namespace fast_float {
+
+namespace detail {
+
+#ifdef FASTFLOAT_X86_DISPATCH
+
+struct cpuid_registers {
+  uint32_t eax;
+  uint32_t ebx;
+  uint32_t ecx;
+  uint32_t edx;
+};
+
+inline cpuid_registers cpuid(uint32_t leaf, uint32_t subleaf) noexcept {
+  cpuid_registers r;
+#ifdef FASTFLOAT_VISUAL_STUDIO
+  int regs[4];
+  __cpuidex(regs, int(leaf), int(subleaf));
+  r.eax = uint32_t(regs[0]);
+  r.ebx = uint32_t(regs[1]);
+  r.ecx = uint32_t(regs[2]);
+  r.edx = uint32_t(regs[3]);
+#else
+  __cpuid_count(leaf, subleaf, r.eax, r.ebx, r.ecx, r.edx);
+#endif
+  return r;
+}
+
+// The register state that the operating system saves (XCR0): the wider
+// registers are only usable if it does.
+inline uint64_t xgetbv0() noexcept {
+#ifdef FASTFLOAT_VISUAL_STUDIO
+  return uint64_t(_xgetbv(0));
+#else
+  uint32_t lo, hi;
+  __asm__ __volatile__("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+  return (uint64_t(hi) << 32) | lo;
+#endif
+}
+
+inline simd_kernel detect_simd_kernel() noexcept {
+  // SSE2 is part of x86-64.
+  uint32_t const max_leaf = cpuid(0, 0).eax;
+  if (max_leaf < 7) {
+    return simd_kernel::sse2;
+  }
+  cpuid_registers const leaf1 = cpuid(1, 0);
+  bool const ssse3 = (leaf1.ecx >> 9) & 1;
+  bool const osxsave = (leaf1.ecx >> 27) & 1;
+  bool const avx = (leaf1.ecx >> 28) & 1;
+  if (!ssse3 || !osxsave || !avx) {
+    return simd_kernel::sse2;
+  }
+  uint64_t const xcr0 = xgetbv0();
+  // XMM and YMM state
+  if ((xcr0 & 0x6) != 0x6) {
+    return simd_kernel::sse2;
+  }
+  cpuid_registers const leaf7 = cpuid(7, 0);
+  bool const avx2 = (leaf7.ebx >> 5) & 1;
+  bool const avx512f = (leaf7.ebx >> 16) & 1;
+  bool const avx512bw = (leaf7.ebx >> 30) & 1;
+  if (!avx2) {
+    return simd_kernel::sse2;
+  }
+  // and the opmask and ZMM state
+  if (avx512f && avx512bw && (xcr0 & 0xE6) == 0xE6) {
+    return simd_kernel::avx512;
+  }
+  return simd_kernel::avx2;
+}
+
+#else
+
+inline simd_kernel detect_simd_kernel() noexcept { return simd_kernel::scalar; }
+
+#endif // FASTFLOAT_X86_DISPATCH
+
+inline std::atomic<simd_kernel> &active_simd_kernel_storage() noexcept {
+  static std::atomic<simd_kernel> kernel(detected_simd_kernel());
+  return kernel;
+}
+
+} // namespace detail
+
+inline simd_kernel detected_simd_kernel() noexcept {
+  static simd_kernel const kernel = detail::detect_simd_kernel();
+  return kernel;
+}
+
+inline simd_kernel active_simd_kernel() noexcept {
+  return detail::active_simd_kernel_storage().load(std::memory_order_relaxed);
+}
+
+inline bool force_simd_kernel(simd_kernel kernel) noexcept {
+  if (int(kernel) < int(simd_kernel::scalar) ||
+      int(kernel) > int(detected_simd_kernel())) {
+    return false;
+  }
+  detail::active_simd_kernel_storage().store(kernel, std::memory_order_relaxed);
+  return true;
+}
+
+} // namespace fast_float
+
+#endif // FASTFLOAT_RUNTIME_DISPATCH
+
+#endif
@@ -207,6 +207,120 @@ compute_float(int64_t q, uint64_t w) noexcept {
   return answer;
 }
 
+// Computes w * 10 ** q like compute_float, for a non-zero mantissa w of up to
+// 128 bits, e.g., up to 38 decimal digits. The product with the 128-bit power
+// of five has 256 bits: as the power of five in the table is off by less than
+// one unit, the product is off by less than 2^128, which can only change the
+// rounding when the bits between the mantissa and 2^128 are all zeros or all
+// ones.
+// When these bits cannot decide the rounding, or when q is out of range or the
+// result is subnormal, the returned power2 is negative: the caller should use
+// another method in such cases.
+template <typename binary>
+fastfloat_really_inline FASTFLOAT_CONSTEXPR20 adjusted_mantissa
+compute_float_128(int64_t q, value128 w) noexcept {
+  adjusted_mantissa answer;
+  answer.mantissa = 0;
+  answer.power2 = -1;
+  if ((q < binary::smallest_power_of_ten()) ||
+      (q > binary::largest_power_of_ten())) {
+    return answer;
+  }
+  // Normalize w. The power2 below counts the leading zeroes of w as if it had
+  // 64 bits, as in compute_float, so lz is negative when w.high != 0.
+  uint64_t w1 = w.high;
+  uint64_t w0 = w.low;
+  int lz = -64;
+  if (w1 == 0) {
+    w1 = w0;
+    w0 = 0;
+    lz = 0;
+  }
+  int const wlz = leading_zeroes(w1);
+  if (wlz != 0) {
+    w1 = (w1 << wlz) | (w0 >> (64 - wlz));
+    w0 <<= wlz;
+  }
+  lz += wlz;
+
+  int const index = 2 * int(q - powers::smallest_power_of_five);
+  uint64_t const t1 = powers::power_of_five_128[index];
+  uint64_t const t0 = powers::power_of_five_128[index + 1];
+  value128 const p11 = full_multiplication(w1, t1);
+  value128 const p10 = full_multiplication(w1, t0);
+  value128 const p01 = full_multiplication(w0, t1);
+  value128 const p00 = full_multiplication(w0, t0);
+  // The product is z3:z2:z1:z0, from the most significant word.
+  uint64_t z1 = p00.high + p10.low;
+  uint64_t carry = uint64_t(z1 < p10.low);
+  z1 += p01.low;
+  carry += uint64_t(z1 < p01.low);
+  uint64_t z2 = p11.low + carry;
+  uint64_t carry2 = uint64_t(z2 < carry);
+  z2 += p10.high;
+  carry2 += uint64_t(z2 < p10.high);
+  z2 += p01.high;
+  carry2 += uint64_t(z2 < p01.high);
+  uint64_t const z3 = p11.high + carry2;
+
+  int const upperbit = int(z3 >> 63);
+  int const shift = upperbit + 64 - binary::mantissa_explicit_bits() - 3;
+  answer.mantissa = z3 >> shift;
+  answer.power2 = int32_t(detail::power(int32_t(q)) + upperbit - lz -
+                          binary::minimum_exponent());
+  if (answer.power2 <= 0) { // subnormal or zero
+    answer.power2 = -1;
+    return answer;
+  }
+  uint64_t const low_mask = (uint64_t(1) << shift) - 1;
+  bool const low_zero = ((z3 & low_mask) == 0) && (z2 <= 1);
+  bool const low_ones = ((z3 & low_mask) == low_mask) && (z2 == ~uint64_t(0));
+  // The power of five is exact for q in [0, 55], and so is the product.
+  if ((q >= 0) && (q <= 55)) {
+    if (low_zero && (z2 == 0) && (z1 == 0) && (p00.low == 0) &&
+        ((answer.mantissa & 3) == 1)) {
+      // We fall right in between two floats: round to even.
+      answer.mantissa &= ~uint64_t(1);
+    }
+  } else if (low_zero || low_ones) {
+    // The error could carry into, or borrow from, the rounding bits, or the
+    // value could be right in between two floats.
+    answer.power2 = -1;
+    return answer;
+  }
+
+  answer.mantissa += (answer.mantissa & 1); // round up
+  answer.mantissa >>= 1;
+  if (answer.mantissa >= (uint64_t(2) << binary::mantissa_explicit_bits())) {
+    answer.mantissa = (uint64_t(1) << binary::mantissa_explicit_bits());
+    answer.power2++; // undo previous addition
+  }
+
+  answer.mantissa &= ~(uint64_t(1) << binary::mantissa_explicit_bits());
+  if (answer.power2 >= binary::infinite_power()) { // infinity
+    answer.power2 = binary::infinite_power();
+    answer.mantissa = 0;
+  }
+  return answer;
+}
+
+// Computes w[i] * 10 ** q[i] for the `count` pairs of the arrays `q` and `w`,
+// like compute_float, into answers[i]. The values are independent, so the
+// processor overlaps their table lookups and multiplications. As with
+// compute_float, the caller should recompute the values for which
+// answers[i].power2 is negative; returns how many there are.
+template <typename binary>
+FASTFLOAT_CONSTEXPR20 size_t
+compute_float_batch(int64_t const *q, uint64_t const *w,
+                    adjusted_mantissa *answers, size_t count) noexcept {
+  size_t invalid = 0;
+  for (size_t i = 0; i < count; i++) {
+    answers[i] = compute_float<binary>(q[i], w[i]);
+    invalid += size_t(answers[i].power2 < 0);
+  }
+  return invalid;
+}
+
 } // namespace fast_float
 
 #endif
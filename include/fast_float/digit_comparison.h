@@ -8,6 +8,7 @@
 #include "float_common.h"
 #include "bigint.h"
 #include "ascii_number.h"
+#include "decimal_to_binary.h"
 
 namespace fast_float {
 
@@ -251,6 +252,46 @@ round_up_bigint(bigint &big, size_t &count) noexcept {
   count++;
 }
 
+// parse the first 38 significant digits of a number with more than 19
+// significant digits into a 128-bit integer: the first 19 digits are
+// num.mantissa. sets `digits` to the number of digits parsed, and `truncated`
+// if any non-zero digits were left out.
+template <typename UC>
+inline FASTFLOAT_CONSTEXPR20 value128
+parse_mantissa_128(parsed_number_string_t<UC> &num, int32_t &digits,
+                   bool &truncated) noexcept {
+  constexpr int32_t max_digits = 38;
+  uint64_t parts[2] = {0, 0};
+  digits = 0;
+  UC const *p = num.integer.ptr;
+  UC const *pend = p + num.integer.len();
+  skip_zeros(p, pend);
+  while ((p != pend) && (digits < max_digits)) {
+    parts[digits / 19] = parts[digits / 19] * 10 + uint64_t(*p - UC('0'));
+    ++p;
+    ++digits;
+  }
+  truncated = is_truncated(p, pend);
+  if (num.fraction.ptr != nullptr) {
+    p = num.fraction.ptr;
+    pend = p + num.fraction.len();
+    if (digits == 0) {
+      skip_zeros(p, pend);
+    }
+    while ((p != pend) && (digits < max_digits)) {
+      parts[digits / 19] = parts[digits / 19] * 10 + uint64_t(*p - UC('0'));
+      ++p;
+      ++digits;
+    }
+    truncated |= is_truncated(p, pend);
+  }
+  value128 answer =
+      full_multiplication(parts[0], powers_of_ten_uint64[digits - 19]);
+  answer.low += parts[1];
+  answer.high += uint64_t(answer.low < parts[1]);
+  return answer;
+}
+
 // parse the significant digits into a big integer
 template <typename UC>
 inline FASTFLOAT_CONSTEXPR20 void
@@ -415,6 +456,33 @@ inline FASTFLOAT_CONSTEXPR20 adjusted_mantissa negative_digit_comp(
   return answer;
 }
 
+// for a number with more than 19 significant digits, when num.mantissa and
+// num.mantissa + 1 round differently, try again with the first 38 significant
+// digits as a 128-bit mantissa, with compute_float_128: its power of five is
+// off by less than one unit, and it gives up when that may change the rounding.
+// when the 38 digits are all the digits, the 128-bit mantissa is exact;
+// otherwise, we need the same rounding with the mantissa and the mantissa + 1.
+// returns an adjusted_mantissa with a negative power2 if this cannot decide
+// (or when compute_float_128 gives up), so that the caller falls back on
+// digit_comp.
+template <typename T, typename UC>
+inline FASTFLOAT_CONSTEXPR20 adjusted_mantissa
+long_mantissa_comp(parsed_number_string_t<UC> &num) noexcept {
+  int32_t digits;
+  bool truncated;
+  value128 w = parse_mantissa_128(num, digits, truncated);
+  int64_t const q = num.exponent - (digits - 19);
+  adjusted_mantissa am = compute_float_128<binary_format<T>>(q, w);
+  if (truncated && am.power2 >= 0) {
+    w.low++;
+    w.high += uint64_t(w.low == 0);
+    if (am != compute_float_128<binary_format<T>>(q, w)) {
+      am.power2 = -1;
+    }
+  }
+  return am;
+}
+
 // parse the significant digits as a big integer to unambiguously round
 // the significant digits. here, we are trying to determine how to round
 // an extended float representation close to `b+h`, halfway between `b`
@@ -28,7 +28,10 @@ namespace fast_float {
  * fast_float::chars_format::scientific` are set to determine whether we allow
  * the fixed point and scientific notation respectively. The default is
  * `fast_float::chars_format::general` which allows both `fixed` and
- * `scientific`.
+ * `scientific`. With `fast_float::chars_format::hex` alone, the numbers are
+ * hexadecimal, as with std::from_chars (e.g., "1.8p3", without "0x"); with
+ * `general | hex`, the numbers that start with "0x" or "0X" are hexadecimal
+ * (e.g., "0x1.8p3", as printed by `printf("%a")`) and the others are decimal.
  */
 template <typename T, typename UC = char,
           typename = FASTFLOAT_ENABLE_IF(is_supported_float_type<T>::value)>
@@ -45,6 +48,42 @@ FASTFLOAT_CONSTEXPR20 from_chars_result_t<UC>
 from_chars_advanced(UC const *first, UC const *last, T &value,
                     parse_options_t<UC> options) noexcept;
 
+/**
+ * The number of code units past `last` that `from_chars_padded` may read.
+ */
+constexpr size_t from_chars_padding = 16;
+
+/**
+ * Like from_chars_advanced, but the caller guarantees that the input is
+ * padded: the `from_chars_padding` code units that follow `last` are readable
+ * and initialized (their values do not matter), e.g., with buffers allocated
+ * with some slack. The result is the same as with from_chars_advanced.
+ *
+ * Integers in base 10 are then parsed eight digits at a time, including the
+ * last digits of a number, without checking for the end of the input at each
+ * digit, which is faster. Floating-point numbers are parsed as with
+ * from_chars_advanced.
+ */
+template <typename T, typename UC = char>
+FASTFLOAT_CONSTEXPR20 from_chars_result_t<UC>
+from_chars_padded(UC const *first, UC const *last, T &value,
+                  parse_options_t<UC> options = parse_options_t<UC>()) noexcept;
+
+/**
+ * Like from_chars_advanced, but the options are template arguments, e.g.,
+ * `from_chars<double, chars_format::json>(first, last, value)`, or
+ * `from_chars<double, chars_format::general, ','>(first, last, value)` for a
+ * decimal comma. The result is the same as with from_chars_advanced.
+ *
+ * The tests of the format are then resolved at compile time, and the parser is
+ * specialized for the format: use it when the format of a hot loop is fixed.
+ * `Base` is used for integer types only.
+ */
+template <typename T, chars_format Fmt, char DecimalPoint = '.', int Base = 10,
+          typename UC = char>
+FASTFLOAT_CONSTEXPR20 from_chars_result_t<UC>
+from_chars(UC const *first, UC const *last, T &value) noexcept;
+
 /**
  * This function multiplies an integer number by a power of 10 and returns
  * the result as a double precision floating-point value that is correctly
@@ -78,14 +117,195 @@ FASTFLOAT_CONSTEXPR20
     integer_times_pow10(int64_t mantissa, int decimal_exponent) noexcept;
 
 /**
- * from_chars for integer types.
+ * Batch versions of `integer_times_pow10()`, e.g., to decode a column of
+ * decimal numbers: stores `mantissa[i] * 10^decimal_exponent[i]` in `out[i]`
+ * for each `i` in [0, count). The second overload uses the same
+ * `decimal_exponent` (a fixed scale) for all values. The values are exactly
+ * those of `integer_times_pow10<T>()`, and `T` defaults to `double`.
+ *
+ * The floating-point rounding mode is checked once per call rather than once
+ * per value, and with a fixed scale, the common case is a loop that the
+ * compiler can vectorize.
+ */
+template <typename T = double>
+FASTFLOAT_CONSTEXPR20
+    typename std::enable_if<is_supported_float_type<T>::value>::type
+    integer_times_pow10_many(int64_t const *mantissa,
+                             int const *decimal_exponent, T *out,
+                             size_t count) noexcept;
+template <typename T = double>
+FASTFLOAT_CONSTEXPR20
+    typename std::enable_if<is_supported_float_type<T>::value>::type
+    integer_times_pow10_many(int64_t const *mantissa, int decimal_exponent,
+                             T *out, size_t count) noexcept;
+
+/**
+ * from_chars for integer types, including __int128_t and __uint128_t where
+ * FASTFLOAT_HAS_INT128 is defined.
  */
 template <typename T, typename UC = char,
           typename = FASTFLOAT_ENABLE_IF(is_supported_integer_type<T>::value)>
 FASTFLOAT_CONSTEXPR20 from_chars_result_t<UC>
 from_chars(UC const *first, UC const *last, T &value, int base = 10) noexcept;
 
+/**
+ * This function parses the sequence of numbers in [first,last) that are
+ * separated by one or more characters from `separators`, storing at most `max`
+ * values in the array `out`. Separators found before the first number or after
+ * the last one are ignored. Each number is parsed as with `from_chars_advanced`
+ * (integer or floating-point, depending on `T`) using the given `options`,
+ * and it must be followed by a separator or by `last`. The separators must not
+ * contain characters that can be part of a number.
+ *
+ * The per-call setup (option resolution, white-space mode, etc.) is done once
+ * for the whole buffer, and floating-point numbers are converted in batches,
+ * which makes it faster than calling `from_chars` in a loop.
+ *
+ * In the returned value, `count` is the number of values stored in `out`. On
+ * success, `ec` is the default (`std::errc()`) value and `ptr` points to the
+ * first number that was not parsed (because `max` values were stored) or is
+ * `last`. Otherwise, `ec` contains the error of the first number that could not
+ * be parsed, `ptr` points to its first character and `count` is its index; the
+ * values `out[count]` to `out[max - 1]` are then unspecified.
+ *
+ * The implementation does not throw and does not allocate memory.
+ */
+template <typename T, typename UC = char>
+FASTFLOAT_CONSTEXPR20 from_chars_many_result_t<UC>
+from_chars_many(UC const *first, UC const *last, T *out, size_t max,
+                separator_set separators = separator_set::white_space(),
+                parse_options_t<UC> options = parse_options_t<UC>()) noexcept;
+
+/**
+ * This function parses a decimal number in [first,last), as `from_chars`
+ * parses a floating-point number with the given `options`, into the integer
+ * `value` scaled by 10^Scale, e.g., "19.99" into 1999 cents with Scale = 2,
+ * or "1.5e3" into 1500000 with Scale = 3. The value is exact: there is no
+ * conversion to a binary floating-point number, whatever the number of digits.
+ * `T` is an integer type of at most 64 bits and `Scale` may be negative.
+ *
+ * The digits finer than the scale are handled as `rounding` says: by default,
+ * they must be zeros. A value out of the range of `T` (after the rounding), or
+ * with digits rejected by the rounding, is a `result_out_of_range` error, and
+ * `ptr` then points right after the number. Hexadecimal numbers, infinity and
+ * NaN are not parsed, nor is a minus sign when `T` is unsigned.
+ *
+ * The implementation does not throw and does not allocate memory.
+ */
+template <typename T, int Scale, typename UC = char>
+FASTFLOAT_CONSTEXPR20 from_chars_result_t<UC> from_chars_fixed_point(
+    UC const *first, UC const *last, T &value,
+    fixed_point_rounding rounding = fixed_point_rounding::reject,
+    parse_options_t<UC> options = parse_options_t<UC>()) noexcept;
+
+/**
+ * This function finds the first number in the text [first,last), e.g., in
+ * "latency=12.5ms", and parses it into `value` as `from_chars_advanced` does
+ * with the given `options` (integer or floating-point, depending on `T`).
+ *
+ * A number starts with a digit, a sign followed by a digit, or a decimal point
+ * followed by a digit (or a sign, a decimal point and a digit). The signs are
+ * the minus sign, which is not part of a number when `T` is unsigned, and the
+ * plus sign with `chars_format::allow_leading_plus`; the decimal point only
+ * starts floating-point numbers. The parse goes as far as the number does,
+ * e.g., to "12.5" in "12.5ms". A start that does not parse (e.g., "1" with
+ * `chars_format::scientific`) is skipped, with the digits that follow it.
+ *
+ * The characters that cannot start a number are skipped with SIMD
+ * instructions when the target has them, for `char`: on text that is mostly
+ * not numeric, this is much faster than trying to parse at each position.
+ *
+ * In the returned value, `start` points to the first character of the number
+ * and `ptr` right after it: the next number is found from `ptr`. The value is
+ * set, and `ec` is the default (`std::errc()`) value, as with `from_chars`;
+ * a number out of the range of `T` is a `result_out_of_range` error. If there
+ * is no number, `ec` is `std::errc::invalid_argument`, and `start` and `ptr`
+ * are `last`. To visit all the numbers of a buffer, see `find_numbers`.
+ *
+ * The implementation does not throw and does not allocate memory.
+ */
+template <typename T, typename UC = char>
+FASTFLOAT_CONSTEXPR20 find_number_result_t<UC> find_and_parse_next(
+    UC const *first, UC const *last, T &value,
+    parse_options_t<UC> options = parse_options_t<UC>()) noexcept;
+
+/**
+ * This function parses the numbers of [first,last) as `from_chars_many` does,
+ * but instead of storing them, it folds each of them into `reducer`, in order,
+ * e.g., to compute their sum, their minimum or their histogram without an
+ * output array: see `sum_reducer`, `min_reducer`, `max_reducer`,
+ * `count_reducer` and `histogram_reducer`. The numbers are parsed as
+ * `typename Reducer::value_type`, and `reducer(value)` is called for each of
+ * them.
+ *
+ * The values are not given to the reducer straight from the parse: they go
+ * through a buffer of 64 values on the stack, the batch of `from_chars_many`,
+ * which stays in the L1 cache. In a batch, the rare numbers that need the
+ * slow conversion are converted after the others, and the buffer puts them
+ * back in order before they are folded. The reducer is copied into a local
+ * variable for the whole call, so that its state can stay in registers.
+ *
+ * The returned value is that of `from_chars_many` with an unbounded `max`:
+ * `count` is the number of values given to the reducer, and on error, the
+ * values before the number that could not be parsed have been given to it.
+ *
+ * The implementation does not throw and does not allocate memory.
+ */
+template <typename Reducer, typename UC = char>
+FASTFLOAT_CONSTEXPR20 from_chars_many_result_t<UC>
+parse_reduce(UC const *first, UC const *last, separator_set separators,
+             Reducer &reducer,
+             parse_options_t<UC> options = parse_options_t<UC>()) noexcept;
+
+#ifdef FASTFLOAT_RUNTIME_DISPATCH
+/**
+ * The kernels of the runtime dispatch, which is enabled by defining
+ * `FASTFLOAT_RUNTIME_DISPATCH` before including fast_float. On x86-64 (with
+ * GCC, Clang or Visual Studio), `from_chars_many` for `char` and the separator
+ * scan of `from_chars_many_parallel` then use the best kernel that the
+ * processor supports, whatever the compiler flags:
+ *
+ * - `scalar`: no SIMD; the digits are read eight at a time from 64-bit words.
+ * - `sse2`: the baseline of x86-64, for the separator scan.
+ * - `avx2`: SSSE3 for runs of up to 16 digits, AVX2 for the separator scan.
+ * - `avx512`: AVX-512BW for the separator scan (64 bytes at a time), and the
+ *   digit loops of `avx2`: 16 digits are already more than fit in a step.
+ *
+ * The other functions keep the paths chosen at compile time. On other targets,
+ * the processor is not probed: the detected kernel is `scalar`, and the bulk
+ * parse keeps its compile-time paths as well.
+ */
+enum class simd_kernel { scalar = 0, sse2 = 1, avx2 = 2, avx512 = 3 };
+
+/**
+ * The best kernel that the processor (and the operating system) supports. The
+ * processor is probed with cpuid once, at the first call.
+ */
+simd_kernel detected_simd_kernel() noexcept;
+
+/**
+ * The kernel that the dispatched functions use: by default, the detected one.
+ */
+simd_kernel active_simd_kernel() noexcept;
+
+/**
+ * Makes the dispatched functions use the given kernel, e.g., so that tests and
+ * benchmarks can compare the kernels on one machine. Returns false, and leaves
+ * the active kernel as it is, if the processor does not support it. The
+ * setting is global: it applies to the calls that start afterwards, in all
+ * threads.
+ */
+bool force_simd_kernel(simd_kernel kernel) noexcept;
+#endif
+
 } // namespace fast_float
 
 #include "parse_number.h"
+#include "parse_context.h"
+#include "fixed_point.h"
+#include "cpu_dispatch.h"
+#include "parse_many.h"
+#include "stream_parser.h"
+#include "find_number.h"
+#include "parse_reduce.h"
 #endif // FASTFLOAT_FAST_FLOAT_H
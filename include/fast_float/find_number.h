@@ -0,0 +1,331 @@
+#ifndef FASTFLOAT_FIND_NUMBER_H
+#define FASTFLOAT_FIND_NUMBER_H
+
+#include "ascii_number.h"
+#include "float_common.h"
+#include "parse_context.h"
+#include "parse_many.h"
+
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <system_error>
+#include <type_traits>
+
+namespace fast_float {
+
+namespace detail {
+
+// The characters other than the digits that may start a number: the signs and
+// the decimal point, or '0' (which is a digit anyway) when they may not.
+template <typename UC> struct number_start_chars {
+  UC minus;
+  UC plus;
+  UC dot;
+};
+
+template <typename UC>
+fastfloat_really_inline constexpr bool
+may_start_number(UC c, number_start_chars<UC> chars) noexcept {
+  return is_integer(c) || (c == chars.minus) || (c == chars.plus) ||
+         (c == chars.dot);
+}
+
+#ifdef FASTFLOAT_HAS_SIMD
+// Returns a 64-bit mask with the bits set for the characters in [p, p + 64)
+// that are digits or one of `chars`.
+fastfloat_really_inline uint64_t
+number_start_mask(char const *p, number_start_chars<char> chars) noexcept {
+#ifdef FASTFLOAT_AVX2
+  FASTFLOAT_SIMD_DISABLE_WARNINGS
+  __m256i const zero = _mm256_set1_epi8('0');
+  __m256i const nine = _mm256_set1_epi8(9);
+  __m256i const minus = _mm256_set1_epi8(chars.minus);
+  __m256i const plus = _mm256_set1_epi8(chars.plus);
+  __m256i const dot = _mm256_set1_epi8(chars.dot);
+  uint64_t mask = 0;
+  for (int j = 0; j < 2; j++) {
+    __m256i const d =
+        _mm256_loadu_si256(reinterpret_cast<__m256i const *>(p + 32 * j));
+    // d - '0' <= 9, as unsigned bytes
+    __m256i const x = _mm256_sub_epi8(d, zero);
+    __m256i e = _mm256_cmpeq_epi8(_mm256_max_epu8(x, nine), nine);
+    e = _mm256_or_si256(e, _mm256_cmpeq_epi8(d, minus));
+    e = _mm256_or_si256(e, _mm256_cmpeq_epi8(d, plus));
+    e = _mm256_or_si256(e, _mm256_cmpeq_epi8(d, dot));
+    mask |= uint64_t(uint32_t(_mm256_movemask_epi8(e))) << (32 * j);
+  }
+  return mask;
+  FASTFLOAT_SIMD_RESTORE_WARNINGS
+#elif defined(FASTFLOAT_SSE2)
+  FASTFLOAT_SIMD_DISABLE_WARNINGS
+  __m128i const zero = _mm_set1_epi8('0');
+  __m128i const nine = _mm_set1_epi8(9);
+  __m128i const minus = _mm_set1_epi8(chars.minus);
+  __m128i const plus = _mm_set1_epi8(chars.plus);
+  __m128i const dot = _mm_set1_epi8(chars.dot);
+  uint64_t mask = 0;
+  for (int j = 0; j < 4; j++) {
+    __m128i const d =
+        _mm_loadu_si128(reinterpret_cast<__m128i const *>(p + 16 * j));
+    // d - '0' <= 9, as unsigned bytes
+    __m128i const x = _mm_sub_epi8(d, zero);
+    __m128i e = _mm_cmpeq_epi8(_mm_max_epu8(x, nine), nine);
+    e = _mm_or_si128(e, _mm_cmpeq_epi8(d, minus));
+    e = _mm_or_si128(e, _mm_cmpeq_epi8(d, plus));
+    e = _mm_or_si128(e, _mm_cmpeq_epi8(d, dot));
+    mask |= uint64_t(uint32_t(_mm_movemask_epi8(e))) << (16 * j);
+  }
+  return mask;
+  FASTFLOAT_SIMD_RESTORE_WARNINGS
+#elif defined(FASTFLOAT_NEON)
+  FASTFLOAT_SIMD_DISABLE_WARNINGS
+  uint8_t const *bytes = reinterpret_cast<uint8_t const *>(p);
+  uint8x16_t const zero = vdupq_n_u8('0');
+  uint8x16_t const nine = vdupq_n_u8(9);
+  uint8x16_t const minus = vdupq_n_u8(uint8_t(chars.minus));
+  uint8x16_t const plus = vdupq_n_u8(uint8_t(chars.plus));
+  uint8x16_t const dot = vdupq_n_u8(uint8_t(chars.dot));
+  uint8x16_t e[4];
+  for (int j = 0; j < 4; j++) {
+    uint8x16_t const d = vld1q_u8(bytes + 16 * j);
+    e[j] = vcleq_u8(vsubq_u8(d, zero), nine);
+    e[j] = vorrq_u8(e[j], vceqq_u8(d, minus));
+    e[j] = vorrq_u8(e[j], vceqq_u8(d, plus));
+    e[j] = vorrq_u8(e[j], vceqq_u8(d, dot));
+  }
+  return neon_movemask64(e[0], e[1], e[2], e[3]);
+  FASTFLOAT_SIMD_RESTORE_WARNINGS
+#endif
+}
+#endif // FASTFLOAT_HAS_SIMD
+
+// Returns the first code unit of [p, last) that may start a number, or last.
+template <typename UC, FASTFLOAT_ENABLE_IF(!std::is_same<UC, char>::value) = 0>
+fastfloat_really_inline FASTFLOAT_CONSTEXPR14 UC const *
+skip_to_number_start(UC const *p, UC const *last,
+                     number_start_chars<UC> chars) noexcept {
+  while ((p != last) && !may_start_number(*p, chars)) {
+    ++p;
+  }
+  return p;
+}
+
+// For char, 64 characters at a time: most of them cannot start a number in
+// text that is mostly not numeric.
+fastfloat_really_inline FASTFLOAT_CONSTEXPR20 char const *
+skip_to_number_start(char const *p, char const *last,
+                     number_start_chars<char> chars) noexcept {
+#ifdef FASTFLOAT_HAS_SIMD
+  if (!cpp20_and_in_constexpr()) {
+    while (last - p >= 64) {
+      uint64_t const mask = number_start_mask(p, chars);
+      if (mask != 0) {
+        return p + countr_zero_64(mask);
+      }
+      p += 64;
+    }
+  }
+#endif
+  while ((p != last) && !may_start_number(*p, chars)) {
+    ++p;
+  }
+  return p;
+}
+
+// Finds the numbers of a text, for find_and_parse_next and number_iterator:
+// the options are resolved once, as with a parse_context.
+template <typename T, typename UC> class number_finder {
+public:
+  FASTFLOAT_CONSTEXPR20 explicit number_finder(
+      parse_options_t<UC> options) noexcept
+      : context(options), chars(make_chars(context.options())) {}
+
+  // The first number of [p, last): see find_and_parse_next.
+  FASTFLOAT_CONSTEXPR20 find_number_result_t<UC>
+  find(UC const *p, UC const *last, T &value) const noexcept {
+    find_number_result_t<UC> answer;
+    for (;;) {
+      p = skip_to_number_start(p, last, chars);
+      if (p == last) {
+        break;
+      }
+      if (!starts_number(p, last)) {
+        ++p;
+        continue;
+      }
+      from_chars_result_t<UC> const r = context.parse(p, last, value);
+      if (r.ec != std::errc::invalid_argument) {
+        answer.start = p;
+        answer.ptr = r.ptr;
+        answer.ec = r.ec;
+        return answer;
+      }
+      // The start does not parse: skip it, with the digits that follow it.
+      ++p;
+      while ((p != last) && is_integer(*p)) {
+        ++p;
+      }
+    }
+    answer.start = last;
+    answer.ptr = last;
+    answer.ec = std::errc::invalid_argument;
+    return answer;
+  }
+
+private:
+  static constexpr number_start_chars<UC>
+  make_chars(parse_options_t<UC> options) noexcept {
+    return {std::numeric_limits<T>::is_signed ? UC('-') : UC('0'),
+            (uint64_t(options.format & chars_format::allow_leading_plus) &&
+             !uint64_t(options.format & basic_json_fmt))
+                ? UC('+')
+                : UC('0'),
+            is_supported_float_type<T>::value ? options.decimal_point
+                                              : UC('0')};
+  }
+
+  // Whether the character at p, which may start a number, is followed by what
+  // a number needs: a sign or the decimal point must be followed by a digit,
+  // or a sign by the decimal point and a digit.
+  FASTFLOAT_CONSTEXPR14 bool starts_number(UC const *p,
+                                           UC const *last) const noexcept {
+    if (is_integer(*p)) {
+      return true;
+    }
+    if (last - p < 2) {
+      return false;
+    }
+    return is_integer(p[1]) || ((*p != chars.dot) && (p[1] == chars.dot) &&
+                                (last - p >= 3) && is_integer(p[2]));
+  }
+
+  parse_context<T, UC> context;
+  number_start_chars<UC> chars;
+};
+
+} // namespace detail
+
+template <typename T, typename UC>
+FASTFLOAT_CONSTEXPR20 find_number_result_t<UC>
+find_and_parse_next(UC const *first, UC const *last, T &value,
+                    parse_options_t<UC> options) noexcept {
+  static_assert(is_supported_float_type<T>::value ||
+                    is_supported_integer_type<T>::value,
+                "only integer and floating-point types are supported");
+  static_assert(is_supported_char_type<UC>::value,
+                "only char, wchar_t, char16_t and char32_t are supported");
+  return detail::number_finder<T, UC>(options).find(first, last, value);
+}
+
+/**
+ * An input iterator over the numbers of a text, as `find_and_parse_next`
+ * finds them, e.g., "12.5", "200" and "1.2e6" in
+ * "latency=12.5ms status=200 bytes=1.2e6". The numbers out of the range of
+ * `T` are skipped: use `find_and_parse_next` to see them. A
+ * default-constructed iterator is the end of the numbers.
+ *
+ * The options are resolved once, when the iterator is built, as with a
+ * `parse_context`; the iterator does not allocate memory.
+ */
+template <typename T, typename UC = char> class number_iterator {
+public:
+  using iterator_category = std::input_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using pointer = T const *;
+  using reference = T const &;
+
+  FASTFLOAT_CONSTEXPR20 number_iterator() noexcept
+      : finder(parse_options_t<UC>()), last(nullptr), found{}, value{} {}
+
+  FASTFLOAT_CONSTEXPR20
+  number_iterator(UC const *first, UC const *last_,
+                  parse_options_t<UC> options = parse_options_t<UC>()) noexcept
+      : finder(options), last(last_), found{}, value{} {
+    found.ptr = first;
+    next();
+  }
+
+  FASTFLOAT_CONSTEXPR20 reference operator*() const noexcept { return value; }
+  FASTFLOAT_CONSTEXPR20 pointer operator->() const noexcept { return &value; }
+
+  // Where the current number is: its `start`, and `ptr` right after it.
+  FASTFLOAT_CONSTEXPR20 find_number_result_t<UC> const &
+  position() const noexcept {
+    return found;
+  }
+
+  FASTFLOAT_CONSTEXPR20 number_iterator &operator++() noexcept {
+    next();
+    return *this;
+  }
+
+  FASTFLOAT_CONSTEXPR20 number_iterator operator++(int) noexcept {
+    number_iterator const before = *this;
+    next();
+    return before;
+  }
+
+  friend FASTFLOAT_CONSTEXPR20 bool
+  operator==(number_iterator const &a, number_iterator const &b) noexcept {
+    return a.found.start == b.found.start;
+  }
+
+  friend FASTFLOAT_CONSTEXPR20 bool
+  operator!=(number_iterator const &a, number_iterator const &b) noexcept {
+    return !(a == b);
+  }
+
+private:
+  FASTFLOAT_CONSTEXPR20 void next() noexcept {
+    do {
+      found = finder.find(found.ptr, last, value);
+    } while (found.ec == std::errc::result_out_of_range);
+    if (found.ec != std::errc()) {
+      found.start = nullptr;
+    }
+  }
+
+  detail::number_finder<T, UC> finder;
+  UC const *last;
+  // start is null at the end.
+  find_number_result_t<UC> found;
+  T value;
+};
+
+/**
+ * The numbers of the text [first, last), for a range-based for loop, e.g.,
+ * `for (double x : fast_float::find_numbers<double>(first, last)) { ... }`.
+ */
+template <typename T, typename UC = char> class number_range {
+public:
+  FASTFLOAT_CONSTEXPR20
+  number_range(UC const *first_, UC const *last_,
+               parse_options_t<UC> options_ = parse_options_t<UC>()) noexcept
+      : first(first_), last(last_), options(options_) {}
+
+  FASTFLOAT_CONSTEXPR20 number_iterator<T, UC> begin() const noexcept {
+    return number_iterator<T, UC>(first, last, options);
+  }
+
+  FASTFLOAT_CONSTEXPR20 number_iterator<T, UC> end() const noexcept {
+    return number_iterator<T, UC>();
+  }
+
+private:
+  UC const *first;
+  UC const *last;
+  parse_options_t<UC> options;
+};
+
+template <typename T, typename UC = char>
+FASTFLOAT_CONSTEXPR20 number_range<T, UC>
+find_numbers(UC const *first, UC const *last,
+             parse_options_t<UC> options = parse_options_t<UC>()) noexcept {
+  return number_range<T, UC>(first, last, options);
+}
+
+} // namespace fast_float
+
+#endif
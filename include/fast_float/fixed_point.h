@@ -0,0 +1,214 @@
+#ifndef FASTFLOAT_FIXED_POINT_H
+#define FASTFLOAT_FIXED_POINT_H
+
+#include "ascii_number.h"
+#include "digit_comparison.h"
+#include "float_common.h"
+
+#include <cstdint>
+#include <limits>
+#include <system_error>
+#include <type_traits>
+
+namespace fast_float {
+
+namespace detail {
+
+// The part of a scaled number that is finer than a unit, compared to half a
+// unit.
+enum class fraction_of_unit { zero, below_half, half, above_half };
+
+// Rounds the magnitude q, which has lost `fraction`. Returns false if the
+// rounding rejects it, or if q overflows.
+fastfloat_really_inline FASTFLOAT_CONSTEXPR14 bool
+round_fixed_point(uint64_t &q, fraction_of_unit fraction,
+                  fixed_point_rounding rounding) noexcept {
+  if (fraction == fraction_of_unit::zero ||
+      rounding == fixed_point_rounding::toward_zero) {
+    return true;
+  }
+  if (rounding == fixed_point_rounding::reject) {
+    return false;
+  }
+  bool const up =
+      (fraction == fraction_of_unit::above_half) ||
+      ((fraction == fraction_of_unit::half) &&
+       ((rounding == fixed_point_rounding::nearest_away) || (q & 1) != 0));
+  if (up) {
+    if (q == std::numeric_limits<uint64_t>::max()) {
+      return false;
+    }
+    ++q;
+  }
+  return true;
+}
+
+// The magnitude q of m * 10^e, with m of at most 19 digits. Returns false if
+// it does not fit, or if the rounding rejects it.
+fastfloat_really_inline FASTFLOAT_CONSTEXPR20 bool
+scale_fixed_point(uint64_t m, int64_t e, fixed_point_rounding rounding,
+                  uint64_t &q) noexcept {
+  if (m == 0) {
+    q = 0;
+    return true;
+  }
+  if (e >= 0) {
+    if (e > 19) {
+      return false;
+    }
+    value128 const product = full_multiplication(m, powers_of_ten_uint64[e]);
+    q = product.low;
+    return product.high == 0;
+  }
+  if (e < -19) {
+    // m < 10^19, which is less than half of 10^-e
+    q = 0;
+    return round_fixed_point(q, fraction_of_unit::below_half, rounding);
+  }
+  uint64_t const unit = powers_of_ten_uint64[-e];
+  q = m / unit;
+  uint64_t const r = m - q * unit;
+  fraction_of_unit const fraction =
+      (r == 0)           ? fraction_of_unit::zero
+      : (r < unit / 2)   ? fraction_of_unit::below_half
+      : (r == unit / 2)  ? fraction_of_unit::half
+                         : fraction_of_unit::above_half;
+  return round_fixed_point(q, fraction, rounding);
+}
+
+// Reads the digit at `index` in the integer part, then in the fraction, or
+// the next one after the digit separators, and moves `index` past it. Returns
+// false at the end.
+template <typename UC>
+fastfloat_really_inline FASTFLOAT_CONSTEXPR14 bool
+next_span_digit(parsed_number_string_t<UC> const &pns, UC separator,
+                size_t &index, uint64_t &digit) noexcept {
+  size_t const length = pns.integer.len() + pns.fraction.len();
+  for (; index < length; ++index) {
+    UC const c = (index < pns.integer.len())
+                     ? pns.integer[index]
+                     : pns.fraction[index - pns.integer.len()];
+    if (c != separator) {
+      digit = uint64_t(c - UC('0'));
+      ++index;
+      return true;
+    }
+  }
+  return false;
+}
+
+// As scale_fixed_point, for more than 19 significant digits, from all of the
+// digits: parse_number_string has truncated the mantissa to 19 digits, and
+// set the spans, which include the digit separators, if any.
+template <typename UC>
+FASTFLOAT_CONSTEXPR20 bool
+scale_fixed_point_digits(parsed_number_string_t<UC> const &pns, UC separator,
+                         int scale, fixed_point_rounding rounding,
+                         uint64_t &q) noexcept {
+  size_t index = 0;
+  uint64_t digit = 0;
+  while (next_span_digit(pns, separator, index, digit) && (digit == 0)) {
+  }
+  size_t const first_significant = index - 1;
+  int64_t significant = 1;
+  while (next_span_digit(pns, separator, index, digit)) {
+    ++significant;
+  }
+  // The number is the integer of the significant digits, times 10^e. The
+  // mantissa was made of the first 19.
+  int64_t const e = pns.exponent - (significant - 19) + int64_t(scale);
+  // The number of digits that are above the unit.
+  int64_t const integral = significant + e;
+  int64_t const end = integral < 0             ? 0
+                      : integral > significant ? significant
+                                               : integral;
+  q = 0;
+  index = first_significant;
+  for (int64_t k = 0; k < end; ++k) {
+    next_span_digit(pns, separator, index, digit);
+    if (q > (std::numeric_limits<uint64_t>::max() - digit) / 10) {
+      return false;
+    }
+    q = q * 10 + digit;
+  }
+  // q is not zero, since the digits are then all above the unit.
+  for (int64_t zeros = integral - significant; zeros > 0; --zeros) {
+    if (q > std::numeric_limits<uint64_t>::max() / 10) {
+      return false;
+    }
+    q *= 10;
+  }
+  if (end == significant) {
+    return true;
+  }
+  if (integral < 0) {
+    // The first digit below the unit is an implicit zero.
+    return round_fixed_point(q, fraction_of_unit::below_half, rounding);
+  }
+  uint64_t first = 0;
+  next_span_digit(pns, separator, index, first);
+  bool sticky = false;
+  while (!sticky && next_span_digit(pns, separator, index, digit)) {
+    sticky = digit != 0;
+  }
+  fraction_of_unit const fraction =
+      (first > 5 || (first == 5 && sticky)) ? fraction_of_unit::above_half
+      : (first == 5)                        ? fraction_of_unit::half
+      : (first != 0 || sticky)              ? fraction_of_unit::below_half
+                                            : fraction_of_unit::zero;
+  return round_fixed_point(q, fraction, rounding);
+}
+
+} // namespace detail
+
+template <typename T, int Scale, typename UC>
+FASTFLOAT_CONSTEXPR20 from_chars_result_t<UC>
+from_chars_fixed_point(UC const *first, UC const *last, T &value,
+                       fixed_point_rounding rounding,
+                       parse_options_t<UC> options) noexcept {
+
+  static_assert(std::is_integral<T>::value && sizeof(T) <= 8,
+                "only integer types of at most 64 bits are supported");
+  static_assert(is_supported_char_type<UC>::value,
+                "only char, wchar_t, char16_t and char32_t are supported");
+
+  options.format = detail::adjust_for_feature_macros(options.format);
+  if (uint64_t(options.format & chars_format::skip_white_space)) {
+    first = skip_spaces(first, last);
+  }
+  from_chars_result_t<UC> answer;
+  answer.ec = std::errc::invalid_argument;
+  answer.ptr = first;
+  if ((first == last) ||
+      (!std::numeric_limits<T>::is_signed && (*first == UC('-')))) {
+    return answer;
+  }
+  // The spans are only needed, and then set anyway, with too many digits.
+  parsed_number_string_t<UC> const pns =
+      uint64_t(options.format & detail::basic_json_fmt)
+          ? parse_number_string<true, UC>(first, last, options, false)
+          : parse_number_string<false, UC>(first, last, options, false);
+  if (!pns.valid) {
+    return answer;
+  }
+  answer.ptr = pns.lastmatch;
+  uint64_t q = 0;
+  bool const in_range =
+      pns.too_many_digits
+          ? detail::scale_fixed_point_digits(pns, options.digit_separator,
+                                             Scale, rounding, q)
+          : detail::scale_fixed_point(pns.mantissa, pns.exponent + Scale,
+                                      rounding, q);
+  if (!in_range ||
+      q > uint64_t(std::numeric_limits<T>::max()) + uint64_t(pns.negative)) {
+    answer.ec = std::errc::result_out_of_range;
+    return answer;
+  }
+  value = integer_from_magnitude<T>(q, pns.negative);
+  answer.ec = std::errc();
+  return answer;
+}
+
+} // namespace fast_float
+
+#endif
@@ -70,8 +70,10 @@ using from_chars_result = from_chars_result_t<char>;
 
 template <typename UC> struct parse_options_t {
   constexpr explicit parse_options_t(chars_format fmt = chars_format::general,
-                                     UC dot = UC('.'), int b = 10)
-      : format(fmt), decimal_point(dot), base(b) {}
+                                     UC dot = UC('.'), int b = 10,
+                                     UC separator = UC(0), int group = 0)
+      : format(fmt), decimal_point(dot), base(b), digit_separator(separator),
+        digit_group_size(group) {}
 
   /** Which number formats are accepted */
   chars_format format;
@@ -79,10 +81,111 @@ template <typename UC> struct parse_options_t {
   UC decimal_point;
   /** The base used for integers */
   int base;
+  /**
+   * The character that may separate the digits, e.g., ',' for "1,234,567.89"
+   * or '_' for "1_000_000", or 0 for none. A separator must be between two
+   * digits of the integer part or of the fraction, and it must not be the
+   * decimal point or a character that can otherwise be part of a number.
+   */
+  UC digit_separator;
+  /**
+   * With a digit separator, the number of digits of the groups that it
+   * separates, or 0 for any. The groups of the integer part then have that
+   * many digits, except the first one, which may have fewer, and those of the
+   * fraction too, except the last one. Numbers that do not have separators are
+   * not checked.
+   */
+  int digit_group_size;
 };
 
 using parse_options = parse_options_t<char>;
 
+namespace detail {
+// Bit mask of the characters of the null-terminated string `chars` whose
+// code is in [offset, offset + 64).
+constexpr uint64_t ascii_mask(char const *chars, unsigned offset) {
+  return *chars == '\0'
+             ? 0
+             : ((unsigned(uint8_t(*chars)) - offset < 64
+                     ? uint64_t(1) << (unsigned(uint8_t(*chars)) - offset)
+                     : 0) |
+                ascii_mask(chars + 1, offset));
+}
+} // namespace detail
+
+/**
+ * The set of ASCII characters that separate the values parsed by
+ * `from_chars_many`. Non-ASCII characters are never separators.
+ */
+struct separator_set {
+  /** Every character of the null-terminated string `chars` is a separator */
+  constexpr explicit separator_set(char const *chars)
+      : low(detail::ascii_mask(chars, 0)), high(detail::ascii_mask(chars, 64)) {
+  }
+
+  /** The characters recognized by `chars_format::skip_white_space` */
+  static constexpr separator_set white_space() {
+    return separator_set(" \t\n\v\f\r");
+  }
+
+  template <typename UC> constexpr bool contains(UC c) const noexcept {
+    using UnsignedUC = typename std::make_unsigned<UC>::type;
+    return uint64_t(UnsignedUC(c)) < 64
+               ? ((low >> uint64_t(UnsignedUC(c))) & 1) != 0
+           : uint64_t(UnsignedUC(c)) < 128
+               ? ((high >> (uint64_t(UnsignedUC(c)) - 64)) & 1) != 0
+               : false;
+  }
+
+  /** Characters 0 to 63 */
+  uint64_t low;
+  /** Characters 64 to 127 */
+  uint64_t high;
+};
+
+template <typename UC> struct from_chars_many_result_t {
+  UC const *ptr;
+  std::errc ec;
+  /** The number of values stored in the output array */
+  size_t count;
+
+  constexpr explicit operator bool() const noexcept {
+    return ec == std::errc();
+  }
+};
+
+using from_chars_many_result = from_chars_many_result_t<char>;
+
+template <typename UC> struct find_number_result_t {
+  /** The first character of the number that was found, or `last` */
+  UC const *start;
+  /** The character right after the number, or `last` */
+  UC const *ptr;
+  std::errc ec;
+
+  constexpr explicit operator bool() const noexcept {
+    return ec == std::errc();
+  }
+};
+
+using find_number_result = find_number_result_t<char>;
+
+/**
+ * What `from_chars_fixed_point` does with the digits that are finer than the
+ * scale, e.g., with "1.005" and two decimals. Negative values are rounded as
+ * their magnitude.
+ */
+enum class fixed_point_rounding {
+  /** Such digits, unless they are zeros, are a `result_out_of_range` error */
+  reject,
+  /** Truncation */
+  toward_zero,
+  /** To the nearest value, ties to even */
+  nearest_even,
+  /** To the nearest value, ties away from zero (as commonly done by hand) */
+  nearest_away,
+};
+
 } // namespace fast_float
 
 #if FASTFLOAT_HAS_BIT_CAST
@@ -122,6 +225,12 @@ using parse_options = parse_options_t<char>;
 #include <intrin.h>
 #endif
 
+// The 128-bit integers of GCC and clang (__int128_t and __uint128_t) can be
+// parsed.
+#ifdef __SIZEOF_INT128__
+#define FASTFLOAT_HAS_INT128 1
+#endif
+
 #if defined(_MSC_VER) && !defined(__clang__)
 #define FASTFLOAT_VISUAL_STUDIO 1
 #endif
@@ -168,6 +277,14 @@ using parse_options = parse_options_t<char>;
 #define FASTFLOAT_SSE2 1
 #endif
 
+#if defined(__SSSE3__) || defined(__AVX__)
+#define FASTFLOAT_SSSE3 1
+#endif
+
+#if defined(__AVX2__)
+#define FASTFLOAT_AVX2 1
+#endif
+
 #if defined(__aarch64__) || defined(_M_ARM64)
 #define FASTFLOAT_NEON 1
 #endif
@@ -176,6 +293,23 @@ using parse_options = parse_options_t<char>;
 #define FASTFLOAT_HAS_SIMD 1
 #endif
 
+// With FASTFLOAT_RUNTIME_DISPATCH, the bulk parse of x86-64 builds also has
+// kernels for instruction sets that the compiler does not target, and picks
+// the best one that the processor supports at run time (see cpu_dispatch.h).
+// They are compiled with target attributes: such functions can only be inlined
+// into functions with the same target.
+#if defined(FASTFLOAT_RUNTIME_DISPATCH) &&                                     \
+    (defined(__x86_64__) || defined(_M_X64)) && !defined(_M_ARM64EC) &&      \
+    (defined(__GNUC__) || defined(FASTFLOAT_VISUAL_STUDIO))
+#define FASTFLOAT_X86_DISPATCH 1
+#if defined(__GNUC__)
+#define FASTFLOAT_TARGET(isa) __attribute__((target(isa)))
+#else
+// Visual Studio accepts the intrinsics of any instruction set.
+#define FASTFLOAT_TARGET(isa)
+#endif
+#endif
+
 #if defined(__GNUC__)
 // disable -Wcast-align=strict (GCC only)
 #define FASTFLOAT_SIMD_DISABLE_WARNINGS                                        \
@@ -282,6 +416,14 @@ using equiv_uint_t = typename std::conditional<
 
 template <typename T> struct is_supported_integer_type : std::is_integral<T> {};
 
+#ifdef FASTFLOAT_HAS_INT128
+// They are not integral types in the strict modes of libstdc++ (-std=c++17),
+// but std::numeric_limits describes them.
+template <> struct is_supported_integer_type<__int128_t> : std::true_type {};
+
+template <> struct is_supported_integer_type<__uint128_t> : std::true_type {};
+#endif
+
 template <typename UC>
 struct is_supported_char_type
     : std::integral_constant<bool, std::is_same<UC, char>::value ||
@@ -564,6 +706,31 @@ countr_zero_32(uint32_t input_num) {
 #endif
 }
 
+/* count trailing zeroes for 64-bit integers */
+fastfloat_really_inline FASTFLOAT_CONSTEXPR20 int
+countr_zero_64(uint64_t input_num) {
+  if (cpp20_and_in_constexpr()) {
+    return uint32_t(input_num) != 0
+               ? countr_zero_generic_32(uint32_t(input_num))
+               : 32 + countr_zero_generic_32(uint32_t(input_num >> 32));
+  }
+#ifdef FASTFLOAT_VISUAL_STUDIO
+#if defined(_M_X64) || defined(_M_ARM64)
+  unsigned long trailing_zero = 0;
+  if (_BitScanForward64(&trailing_zero, input_num)) {
+    return (int)trailing_zero;
+  }
+  return 64;
+#else
+  return uint32_t(input_num) != 0
+             ? countr_zero_32(uint32_t(input_num))
+             : 32 + countr_zero_32(uint32_t(input_num >> 32));
+#endif
+#else
+  return input_num == 0 ? 64 : __builtin_ctzll(input_num);
+#endif
+}
+
 // slow emulation routine for 32-bit
 fastfloat_really_inline constexpr uint64_t emulu(uint32_t x, uint32_t y) {
   return x * (uint64_t)y;
@@ -1320,6 +1487,10 @@ template <typename = void> struct int_luts {
       10260628712958602189ull, 15943230000000000000ull, 787662783788549761,
       1152921504606846976,     1667889514952984961,     2386420683693101056,
       3379220508056640625,     4738381338321616896};
+
+  static constexpr uint8_t max_leading_digit_u64[] = {
+      1, 1, 3, 2, 3, 4, 1, 1, 1, 3, 8, 2, 8, 2, 15, 6, 2, 1,
+      11, 5, 2, 1, 21, 12, 7, 4, 2, 1, 1, 23, 15, 11, 7, 5, 3};
 };
 
 #if FASTFLOAT_DETAIL_MUST_DEFINE_CONSTEXPR_VARIABLE
@@ -1330,6 +1501,8 @@ template <typename T> constexpr size_t int_luts<T>::maxdigits_u64[];
 
 template <typename T> constexpr uint64_t int_luts<T>::min_safe_u64[];
 
+template <typename T> constexpr uint8_t int_luts<T>::max_leading_digit_u64[];
+
 #endif
 
 template <typename UC>
@@ -1352,6 +1525,12 @@ fastfloat_really_inline constexpr uint64_t min_safe_u64(int base) {
   return int_luts<>::min_safe_u64[base - 2];
 }
 
+// If a u64 is exactly max_digits_u64() in length, and its leading digit is
+// greater than this, it has overflowed.
+fastfloat_really_inline constexpr uint8_t max_leading_digit_u64(int base) {
+  return int_luts<>::max_leading_digit_u64[base - 2];
+}
+
 static_assert(std::is_same<equiv_uint_t<double>, uint64_t>::value,
               "equiv_uint should be uint64_t for double");
 static_assert(std::numeric_limits<double>::is_iec559,
@@ -1452,6 +1631,55 @@ constexpr chars_format adjust_for_feature_macros(chars_format fmt) {
 #endif
       ;
 }
+
+template <typename UC>
+constexpr parse_options_t<UC>
+adjust_for_feature_macros(parse_options_t<UC> options) {
+  return parse_options_t<UC>(adjust_for_feature_macros(options.format),
+                             options.decimal_point, options.base,
+                             options.digit_separator, options.digit_group_size);
+}
+
+// The options of the from_chars overload that takes them as template
+// arguments: the members of parse_options_t, as constants, so that the tests
+// of the format fold away. The format is already adjusted.
+template <typename UC, chars_format Fmt, char DecimalPoint, int Base>
+struct constant_parse_options {
+  static constexpr chars_format format = adjust_for_feature_macros(Fmt);
+  static constexpr UC decimal_point = UC(DecimalPoint);
+  static constexpr int base = Base;
+  static constexpr UC digit_separator = UC(0);
+  static constexpr int digit_group_size = 0;
+};
+
+#if FASTFLOAT_DETAIL_MUST_DEFINE_CONSTEXPR_VARIABLE
+
+template <typename UC, chars_format Fmt, char DecimalPoint, int Base>
+constexpr chars_format
+    constant_parse_options<UC, Fmt, DecimalPoint, Base>::format;
+
+template <typename UC, chars_format Fmt, char DecimalPoint, int Base>
+constexpr UC constant_parse_options<UC, Fmt, DecimalPoint, Base>::decimal_point;
+
+template <typename UC, chars_format Fmt, char DecimalPoint, int Base>
+constexpr int constant_parse_options<UC, Fmt, DecimalPoint, Base>::base;
+
+template <typename UC, chars_format Fmt, char DecimalPoint, int Base>
+constexpr UC
+    constant_parse_options<UC, Fmt, DecimalPoint, Base>::digit_separator;
+
+template <typename UC, chars_format Fmt, char DecimalPoint, int Base>
+constexpr int
+    constant_parse_options<UC, Fmt, DecimalPoint, Base>::digit_group_size;
+
+#endif
+
+template <typename UC, chars_format Fmt, char DecimalPoint, int Base>
+constexpr constant_parse_options<UC, Fmt, DecimalPoint, Base>
+adjust_for_feature_macros(
+    constant_parse_options<UC, Fmt, DecimalPoint, Base> options) {
+  return options;
+}
 } // namespace detail
 } // namespace fast_float
 
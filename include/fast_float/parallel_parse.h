@@ -0,0 +1,192 @@
+#ifndef FASTFLOAT_PARALLEL_PARSE_H
+#define FASTFLOAT_PARALLEL_PARSE_H
+
+// This header is not included by fast_float.h: it uses std::thread, so that
+// programs using it must be linked with the threads library (e.g.,
+// Threads::Threads in CMake).
+
+#include "fast_float.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace fast_float {
+
+/**
+ * Like `from_chars_many`, but splits a large buffer into chunks that are
+ * parsed concurrently by `thread_count` threads, including the calling one. By
+ * default (0), we use `std::thread::hardware_concurrency()` threads.
+ *
+ * Each split point is moved forward to the next separator, so that no number
+ * is cut. The threads first count the numbers of the chunks, and then parse
+ * each chunk directly at its final place in `out`: the values are in the input
+ * order. The chunks are claimed dynamically, so a thread that is done with its
+ * chunk picks up another one. The returned value, and the values stored in
+ * `out` up to `count`, are exactly those of `from_chars_many`.
+ *
+ * Small buffers are parsed by the calling thread alone. Unlike the rest of the
+ * library, this function allocates memory (a few words per chunk); it throws
+ * `std::bad_alloc` if that fails. If a thread cannot be created, the other
+ * threads do its share of the work.
+ */
+template <typename T, typename UC = char>
+from_chars_many_result_t<UC> from_chars_many_parallel(
+    UC const *first, UC const *last, T *out, size_t max,
+    unsigned thread_count = 0,
+    separator_set separators = separator_set::white_space(),
+    parse_options_t<UC> options = parse_options_t<UC>());
+
+namespace detail {
+
+// The chunks are at least that many code units long, so that the threads are
+// worth their cost, and there are a few per thread, for load balancing.
+constexpr size_t parallel_min_chunk_size = size_t(1) << 16;
+constexpr size_t parallel_chunks_per_thread = 4;
+
+fastfloat_really_inline FASTFLOAT_CONSTEXPR14 int
+popcount_64(uint64_t x) noexcept {
+  x = x - ((x >> 1) & 0x5555555555555555);
+  x = (x & 0x3333333333333333) + ((x >> 2) & 0x3333333333333333);
+  x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0f;
+  return int((x * 0x0101010101010101) >> 56);
+}
+
+// Counts the tokens of [first, last), the maximal runs of non-separators, from
+// their starts: the non-separators that follow a separator (or the start of the
+// input). With a separator mask `s`, these are the bits of
+// `~s & ((s << 1) | carry)`.
+template <typename UC>
+size_t count_tokens(UC const *first, UC const *last,
+                    separator_classifier<UC> const &classifier) noexcept {
+  size_t count = 0;
+  uint64_t carry = 1;
+  while (first != last) {
+    size_t const len = size_t(last - first) < 64 ? size_t(last - first) : 64;
+    uint64_t const separators = classifier.classify(first, len);
+    count += size_t(popcount_64(~separators & ((separators << 1) | carry)));
+    carry = separators >> 63;
+    first += len;
+  }
+  return count;
+}
+
+// Runs `work` on `thread_count` threads, including the calling one, and waits
+// for all of them.
+template <typename F> void run_on_threads(unsigned thread_count, F const &work) {
+  std::vector<std::thread> workers;
+  workers.reserve(thread_count - 1);
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+  try {
+#endif
+    for (unsigned i = 1; i < thread_count; i++) {
+      workers.emplace_back(work);
+    }
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+  } catch (std::system_error const &) {
+    // The threads claim the chunks dynamically: fewer threads is fine.
+  }
+#endif
+  work();
+  for (std::thread &w : workers) {
+    w.join();
+  }
+}
+
+template <typename T, typename UC>
+from_chars_many_result_t<UC>
+parse_many_parallel(UC const *first, UC const *last, T *out, size_t max,
+                    unsigned thread_count, size_t min_chunk_size,
+                    separator_set separators, parse_options_t<UC> options) {
+  if (thread_count == 0) {
+    thread_count = std::thread::hardware_concurrency();
+  }
+  size_t const length = size_t(last - first);
+  size_t chunk_count = length / min_chunk_size;
+  if (chunk_count > size_t(thread_count) * parallel_chunks_per_thread) {
+    chunk_count = size_t(thread_count) * parallel_chunks_per_thread;
+  }
+  if (thread_count <= 1 || chunk_count <= 1) {
+    return from_chars_many(first, last, out, max, separators, options);
+  }
+  if (size_t(thread_count) > chunk_count) {
+    thread_count = unsigned(chunk_count);
+  }
+
+  // The chunk i is [bounds[i], bounds[i + 1]). Moving each split point to the
+  // next separator leaves every token within a single chunk; a chunk may end
+  // up empty.
+  std::vector<UC const *> bounds(chunk_count + 1);
+  bounds[0] = first;
+  for (size_t i = 1; i < chunk_count; i++) {
+    UC const *p = first + length / chunk_count * i;
+    if (p < bounds[i - 1]) {
+      p = bounds[i - 1];
+    }
+    while (p != last && !separators.contains(*p)) {
+      ++p;
+    }
+    bounds[i] = p;
+  }
+  bounds[chunk_count] = last;
+
+  // First round: count the tokens of each chunk.
+  separator_classifier<UC> const classifier(separators);
+  std::vector<size_t> offsets(chunk_count + 1);
+  std::atomic<size_t> next_chunk(0);
+  run_on_threads(thread_count, [&]() {
+    size_t i;
+    while ((i = next_chunk.fetch_add(1)) < chunk_count) {
+      offsets[i + 1] = count_tokens(bounds[i], bounds[i + 1], classifier);
+    }
+  });
+  for (size_t i = 0; i < chunk_count; i++) {
+    offsets[i + 1] += offsets[i];
+  }
+
+  // Second round: parse each chunk at its place in `out`, up to `max` values.
+  std::vector<from_chars_many_result_t<UC>> results(chunk_count);
+  next_chunk.store(0);
+  run_on_threads(thread_count, [&]() {
+    size_t i;
+    while ((i = next_chunk.fetch_add(1)) < chunk_count) {
+      // Past `max`, only the first token of a chunk matters, for the pointer.
+      if (offsets[i] <= max) {
+        results[i] = from_chars_many(bounds[i], bounds[i + 1], out + offsets[i],
+                                     max - offsets[i], separators, options);
+      }
+    }
+  });
+
+  // The chunks are in order: the first error, or the first chunk where `max`
+  // is reached, determines the result.
+  from_chars_many_result_t<UC> answer;
+  for (size_t i = 0; i < chunk_count; i++) {
+    answer = results[i];
+    answer.count += offsets[i];
+    if (answer.ec != std::errc() || offsets[i + 1] > max) {
+      return answer;
+    }
+  }
+  answer.ptr = last;
+  return answer;
+}
+
+} // namespace detail
+
+template <typename T, typename UC>
+from_chars_many_result_t<UC>
+from_chars_many_parallel(UC const *first, UC const *last, T *out, size_t max,
+                         unsigned thread_count, separator_set separators,
+                         parse_options_t<UC> options) {
+  return detail::parse_many_parallel(first, last, out, max, thread_count,
+                                     detail::parallel_min_chunk_size,
+                                     separators, options);
+}
+
+} // namespace fast_float
+
+#endif
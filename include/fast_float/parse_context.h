@@ -0,0 +1,110 @@
+#ifndef FASTFLOAT_PARSE_CONTEXT_H
+#define FASTFLOAT_PARSE_CONTEXT_H
+
+#include "float_common.h"
+#include "parse_number.h"
+
+#include <system_error>
+
+namespace fast_float {
+
+namespace detail {
+template <size_t TypeIx> struct parse_context_caller {
+  static_assert(TypeIx > 0, "unsupported type");
+};
+
+template <> struct parse_context_caller<1> {
+  template <typename T, typename UC>
+  fastfloat_really_inline FASTFLOAT_CONSTEXPR20 static from_chars_result_t<UC>
+  call(UC const *first, UC const *last, T &value, parse_options_t<UC> options,
+       bool bjf, bool nearest) noexcept {
+    return from_chars_float_prepared(first, last, value, options, bjf,
+                                     rounding_known{nearest});
+  }
+};
+
+template <> struct parse_context_caller<2> {
+  template <typename T, typename UC>
+  fastfloat_really_inline FASTFLOAT_CONSTEXPR20 static from_chars_result_t<UC>
+  call(UC const *first, UC const *last, T &value, parse_options_t<UC> options,
+       bool, bool) noexcept {
+    return parse_int_string<T, UC>(first, last, value, options);
+  }
+};
+} // namespace detail
+
+/**
+ * Parses numbers one at a time, as `from_chars_advanced` does with the given
+ * `options`, but with the per-call setup done once, when the context is built:
+ * the options are resolved (feature macros, white-space mode, JSON format and
+ * base) and, for floating-point types, the rounding mode of the floating-point
+ * environment is checked. Build a context per thread or per batch, before a
+ * hot loop, rather than per number.
+ *
+ * The rounding mode must not change (e.g., with `fesetround`) while the
+ * context is used: the values could then be rounded incorrectly. Build a new
+ * context after such a change.
+ *
+ * The context is small and can be copied; it does not allocate memory.
+ */
+template <typename T, typename UC = char> class parse_context {
+  static_assert(is_supported_float_type<T>::value ||
+                    is_supported_integer_type<T>::value,
+                "only integer and floating-point types are supported");
+  static_assert(is_supported_char_type<UC>::value,
+                "only char, wchar_t, char16_t and char32_t are supported");
+
+public:
+  FASTFLOAT_CONSTEXPR20 explicit parse_context(
+      parse_options_t<UC> options = parse_options_t<UC>()) noexcept
+      : parse_options(detail::adjust_for_feature_macros(options)),
+        skip_white_space(uint64_t(parse_options.format &
+                                  chars_format::skip_white_space) != 0),
+        bjf(uint64_t(parse_options.format & detail::basic_json_fmt) != 0),
+        valid_base(is_supported_float_type<T>::value ||
+                   (parse_options.base >= 2 && parse_options.base <= 36)),
+        nearest(is_supported_float_type<T>::value &&
+                !cpp20_and_in_constexpr() && detail::rounds_to_nearest()) {}
+
+  // The options, adjusted for the feature macros.
+  constexpr parse_options_t<UC> options() const noexcept {
+    return parse_options;
+  }
+
+  // Whether the rounding mode was to nearest when the context was built.
+  constexpr bool rounds_to_nearest() const noexcept { return nearest; }
+
+  /**
+   * Parses the number at the start of [first, last) into `value`. The result
+   * is that of `from_chars_advanced(first, last, value, options())`.
+   */
+  FASTFLOAT_CONSTEXPR20 from_chars_result_t<UC>
+  parse(UC const *first, UC const *last, T &value) const noexcept {
+    if (skip_white_space) {
+      first = skip_spaces(first, last);
+    }
+    if (first == last || !valid_base) {
+      from_chars_result_t<UC> answer;
+      answer.ec = std::errc::invalid_argument;
+      answer.ptr = first;
+      return answer;
+    }
+    return detail::parse_context_caller<
+        size_t(is_supported_float_type<T>::value) +
+        2 * size_t(is_supported_integer_type<T>::value)>::call(first, last,
+                                                               value,
+                                                               parse_options,
+                                                               bjf, nearest);
+  }
+
+private:
+  parse_options_t<UC> parse_options;
+  bool skip_white_space;
+  bool bjf;
+  bool valid_base;
+  bool nearest;
+};
+
+} // namespace fast_float
+
+#endif
@@ -0,0 +1,662 @@
+#ifndef FASTFLOAT_PARSE_MANY_H
+#define FASTFLOAT_PARSE_MANY_H
+
+#include "cpu_dispatch.h"
+#include "float_common.h"
+#include "parse_number.h"
+
+#include <cstddef>
+#include <system_error>
+#include <type_traits>
+
+#if defined(FASTFLOAT_AVX2) || defined(FASTFLOAT_X86_DISPATCH)
+#include <immintrin.h>
+#elif defined(FASTFLOAT_SSE2)
+#include <emmintrin.h>
+#endif
+
+#ifdef FASTFLOAT_NEON
+#include <arm_neon.h>
+#endif
+
+namespace fast_float {
+
+namespace detail {
+
+// A separator_classifier classifies the input 64 code units at a time into a
+// bitmask of separators, e.g., to count the tokens of a chunk of the input
+// (see parallel_parse.h). The bulk parse itself does not use it: finding the
+// end of a token before parsing it reads the input twice, while parsing the
+// number finds its end anyway.
+
+// The vectorized classifiers compare against each separator in turn, so we
+// only use them when there are few distinct separators.
+constexpr int max_simd_separators = 8;
+
+#ifdef FASTFLOAT_HAS_SIMD
+
+#ifdef FASTFLOAT_NEON
+// NEON has no movemask: keep one bit per byte of the comparison results and
+// add adjacent bytes until each of the 64 bits is in place.
+fastfloat_really_inline uint64_t neon_movemask64(uint8x16_t e0, uint8x16_t e1,
+                                                 uint8x16_t e2,
+                                                 uint8x16_t e3) noexcept {
+  static uint8_t const bit_weights[16] = {1, 2, 4, 8, 16, 32, 64, 128,
+                                          1, 2, 4, 8, 16, 32, 64, 128};
+  uint8x16_t const weights = vld1q_u8(bit_weights);
+  uint8x16_t sum0 = vpaddq_u8(vandq_u8(e0, weights), vandq_u8(e1, weights));
+  uint8x16_t const sum1 =
+      vpaddq_u8(vandq_u8(e2, weights), vandq_u8(e3, weights));
+  sum0 = vpaddq_u8(sum0, sum1);
+  sum0 = vpaddq_u8(sum0, sum0);
+  return vgetq_lane_u64(vreinterpretq_u64_u8(sum0), 0);
+}
+#endif
+
+// The separator masks return a 64-bit mask with the bits set for the
+// characters in [p, p + 64) that are equal to one of `chars[0..count)`.
+
+#ifdef FASTFLOAT_SSE2
+fastfloat_really_inline uint64_t separator_mask_sse2(char const *p,
+                                                     char const *chars,
+                                                     int count) noexcept {
+  FASTFLOAT_SIMD_DISABLE_WARNINGS
+  __m128i const d0 = _mm_loadu_si128(reinterpret_cast<__m128i const *>(p));
+  __m128i const d1 =
+      _mm_loadu_si128(reinterpret_cast<__m128i const *>(p + 16));
+  __m128i const d2 =
+      _mm_loadu_si128(reinterpret_cast<__m128i const *>(p + 32));
+  __m128i const d3 =
+      _mm_loadu_si128(reinterpret_cast<__m128i const *>(p + 48));
+  __m128i e0 = _mm_setzero_si128();
+  __m128i e1 = _mm_setzero_si128();
+  __m128i e2 = _mm_setzero_si128();
+  __m128i e3 = _mm_setzero_si128();
+  for (int i = 0; i < count; i++) {
+    __m128i const c = _mm_set1_epi8(chars[i]);
+    e0 = _mm_or_si128(e0, _mm_cmpeq_epi8(d0, c));
+    e1 = _mm_or_si128(e1, _mm_cmpeq_epi8(d1, c));
+    e2 = _mm_or_si128(e2, _mm_cmpeq_epi8(d2, c));
+    e3 = _mm_or_si128(e3, _mm_cmpeq_epi8(d3, c));
+  }
+  return uint64_t(uint32_t(_mm_movemask_epi8(e0))) |
+         (uint64_t(uint32_t(_mm_movemask_epi8(e1))) << 16) |
+         (uint64_t(uint32_t(_mm_movemask_epi8(e2))) << 32) |
+         (uint64_t(uint32_t(_mm_movemask_epi8(e3))) << 48);
+  FASTFLOAT_SIMD_RESTORE_WARNINGS
+}
+#endif
+
+#if defined(FASTFLOAT_AVX2) || defined(FASTFLOAT_X86_DISPATCH)
+#ifdef FASTFLOAT_AVX2
+#define FASTFLOAT_AVX2_ENTRY fastfloat_really_inline
+#else
+// For the runtime dispatch only: called from generic code.
+#define FASTFLOAT_AVX2_ENTRY FASTFLOAT_TARGET("avx2") inline
+#endif
+FASTFLOAT_AVX2_ENTRY uint64_t separator_mask_avx2(char const *p,
+                                                  char const *chars,
+                                                  int count) noexcept {
+  FASTFLOAT_SIMD_DISABLE_WARNINGS
+  __m256i const lo = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(p));
+  __m256i const hi =
+      _mm256_loadu_si256(reinterpret_cast<__m256i const *>(p + 32));
+  __m256i eq_lo = _mm256_setzero_si256();
+  __m256i eq_hi = _mm256_setzero_si256();
+  for (int i = 0; i < count; i++) {
+    __m256i const c = _mm256_set1_epi8(chars[i]);
+    eq_lo = _mm256_or_si256(eq_lo, _mm256_cmpeq_epi8(lo, c));
+    eq_hi = _mm256_or_si256(eq_hi, _mm256_cmpeq_epi8(hi, c));
+  }
+  return uint64_t(uint32_t(_mm256_movemask_epi8(eq_lo))) |
+         (uint64_t(uint32_t(_mm256_movemask_epi8(eq_hi))) << 32);
+  FASTFLOAT_SIMD_RESTORE_WARNINGS
+}
+#endif
+
+#ifdef FASTFLOAT_X86_DISPATCH
+// A single load and one comparison per separator, straight into a mask.
+FASTFLOAT_TARGET("avx512f,avx512bw")
+inline uint64_t separator_mask_avx512(char const *p, char const *chars,
+                                      int count) noexcept {
+  FASTFLOAT_SIMD_DISABLE_WARNINGS
+  __m512i const d = _mm512_loadu_si512(static_cast<void const *>(p));
+  __mmask64 eq = 0;
+  for (int i = 0; i < count; i++) {
+    eq |= _mm512_cmpeq_epi8_mask(d, _mm512_set1_epi8(chars[i]));
+  }
+  return uint64_t(eq);
+  FASTFLOAT_SIMD_RESTORE_WARNINGS
+}
+#endif
+
+fastfloat_really_inline uint64_t simd_separator_mask(char const *p,
+                                                     char const *chars,
+                                                     int count) noexcept {
+#ifdef FASTFLOAT_AVX2
+  return separator_mask_avx2(p, chars, count);
+#elif defined(FASTFLOAT_SSE2)
+  return separator_mask_sse2(p, chars, count);
+#elif defined(FASTFLOAT_NEON)
+  FASTFLOAT_SIMD_DISABLE_WARNINGS
+  uint8_t const *bytes = reinterpret_cast<uint8_t const *>(p);
+  uint8x16_t const d0 = vld1q_u8(bytes);
+  uint8x16_t const d1 = vld1q_u8(bytes + 16);
+  uint8x16_t const d2 = vld1q_u8(bytes + 32);
+  uint8x16_t const d3 = vld1q_u8(bytes + 48);
+  uint8x16_t e0 = vdupq_n_u8(0);
+  uint8x16_t e1 = vdupq_n_u8(0);
+  uint8x16_t e2 = vdupq_n_u8(0);
+  uint8x16_t e3 = vdupq_n_u8(0);
+  for (int i = 0; i < count; i++) {
+    uint8x16_t const c = vdupq_n_u8(uint8_t(chars[i]));
+    e0 = vorrq_u8(e0, vceqq_u8(d0, c));
+    e1 = vorrq_u8(e1, vceqq_u8(d1, c));
+    e2 = vorrq_u8(e2, vceqq_u8(d2, c));
+    e3 = vorrq_u8(e3, vceqq_u8(d3, c));
+  }
+  return neon_movemask64(e0, e1, e2, e3);
+  FASTFLOAT_SIMD_RESTORE_WARNINGS
+#endif
+}
+
+fastfloat_really_inline uint64_t simd_separator_mask(char16_t const *p,
+                                                     char16_t const *chars,
+                                                     int count) noexcept {
+#ifdef FASTFLOAT_SSE2
+  FASTFLOAT_SIMD_DISABLE_WARNINGS
+  uint64_t mask = 0;
+  for (int j = 0; j < 4; j++) {
+    __m128i const lo =
+        _mm_loadu_si128(reinterpret_cast<__m128i const *>(p + 16 * j));
+    __m128i const hi =
+        _mm_loadu_si128(reinterpret_cast<__m128i const *>(p + 16 * j + 8));
+    __m128i eq_lo = _mm_setzero_si128();
+    __m128i eq_hi = _mm_setzero_si128();
+    for (int i = 0; i < count; i++) {
+      __m128i const c = _mm_set1_epi16(short(chars[i]));
+      eq_lo = _mm_or_si128(eq_lo, _mm_cmpeq_epi16(lo, c));
+      eq_hi = _mm_or_si128(eq_hi, _mm_cmpeq_epi16(hi, c));
+    }
+    // the comparison results are 0 or -1, which packing preserves
+    __m128i const eq = _mm_packs_epi16(eq_lo, eq_hi);
+    mask |= uint64_t(uint32_t(_mm_movemask_epi8(eq))) << (16 * j);
+  }
+  return mask;
+  FASTFLOAT_SIMD_RESTORE_WARNINGS
+#elif defined(FASTFLOAT_NEON)
+  FASTFLOAT_SIMD_DISABLE_WARNINGS
+  uint8x16_t eq[4];
+  for (int j = 0; j < 4; j++) {
+    uint16_t const *units = reinterpret_cast<uint16_t const *>(p + 16 * j);
+    uint16x8_t const lo = vld1q_u16(units);
+    uint16x8_t const hi = vld1q_u16(units + 8);
+    uint16x8_t eq_lo = vdupq_n_u16(0);
+    uint16x8_t eq_hi = vdupq_n_u16(0);
+    for (int i = 0; i < count; i++) {
+      uint16x8_t const c = vdupq_n_u16(uint16_t(chars[i]));
+      eq_lo = vorrq_u16(eq_lo, vceqq_u16(lo, c));
+      eq_hi = vorrq_u16(eq_hi, vceqq_u16(hi, c));
+    }
+    eq[j] = vcombine_u8(vmovn_u16(eq_lo), vmovn_u16(eq_hi));
+  }
+  return neon_movemask64(eq[0], eq[1], eq[2], eq[3]);
+  FASTFLOAT_SIMD_RESTORE_WARNINGS
+#endif
+}
+
+#ifdef FASTFLOAT_X86_DISPATCH
+// The kernels are called for blocks of 64 bytes, so we do not mind the call.
+fastfloat_really_inline uint64_t dispatch_separator_mask(
+    char const *p, char const *chars, int count, simd_kernel kernel) noexcept {
+  switch (kernel) {
+  case simd_kernel::avx512:
+    return separator_mask_avx512(p, chars, count);
+  case simd_kernel::avx2:
+    return separator_mask_avx2(p, chars, count);
+  default:
+    return separator_mask_sse2(p, chars, count);
+  }
+}
+
+// There is only the SSE2 kernel for char16_t.
+fastfloat_really_inline uint64_t
+dispatch_separator_mask(char16_t const *p, char16_t const *chars, int count,
+                        simd_kernel) noexcept {
+  return simd_separator_mask(p, chars, count);
+}
+#endif
+
+#endif // FASTFLOAT_HAS_SIMD
+
+template <typename UC> constexpr bool has_simd_separators() {
+#ifdef FASTFLOAT_HAS_SIMD
+  return std::is_same<UC, char>::value || std::is_same<UC, char16_t>::value;
+#else
+  return false;
+#endif
+}
+
+// Computes the separator mask of a block of `len` <= 64 code units: bit i is
+// set when p[i] is a separator. The bits past `len` are set as well, so that a
+// token running up to the end of the block ends there.
+template <typename UC, bool = has_simd_separators<UC>()>
+struct separator_classifier {
+  FASTFLOAT_CONSTEXPR20 explicit separator_classifier(
+      separator_set separators) noexcept
+      : set(separators) {}
+
+  FASTFLOAT_CONSTEXPR20 uint64_t classify(UC const *p,
+                                          size_t len) const noexcept {
+    uint64_t mask = (len < 64) ? ~uint64_t(0) << len : 0;
+    for (size_t i = 0; i < len; i++) {
+      mask |= uint64_t(set.contains(p[i])) << i;
+    }
+    return mask;
+  }
+
+  separator_set set;
+};
+
+template <typename UC> struct separator_classifier<UC, true> {
+  FASTFLOAT_CONSTEXPR20 explicit separator_classifier(
+      separator_set separators) noexcept
+      : set(separators), chars{}, count(0) {
+#ifdef FASTFLOAT_X86_DISPATCH
+    kernel = cpp20_and_in_constexpr() ? simd_kernel::scalar
+                                      : active_simd_kernel();
+#endif
+    for (int c = 0; c < 128; c++) {
+      if (set.contains(UC(c))) {
+        if (count < max_simd_separators) {
+          chars[count] = UC(c);
+        }
+        count++;
+      }
+    }
+  }
+
+  FASTFLOAT_CONSTEXPR20 uint64_t classify(UC const *p,
+                                          size_t len) const noexcept {
+#ifdef FASTFLOAT_HAS_SIMD
+    if (!cpp20_and_in_constexpr() && len == 64 &&
+        count <= max_simd_separators) {
+#ifdef FASTFLOAT_X86_DISPATCH
+      if (kernel != simd_kernel::scalar) {
+        return dispatch_separator_mask(p, chars, count, kernel);
+      }
+#else
+      return simd_separator_mask(p, chars, count);
+#endif
+    }
+#endif
+    uint64_t mask = (len < 64) ? ~uint64_t(0) << len : 0;
+    for (size_t i = 0; i < len; i++) {
+      mask |= uint64_t(set.contains(p[i])) << i;
+    }
+    return mask;
+  }
+
+  separator_set set;
+  UC chars[max_simd_separators];
+  int count;
+#ifdef FASTFLOAT_X86_DISPATCH
+  // The kernel that was active when the classifier was made.
+  simd_kernel kernel{simd_kernel::scalar};
+#endif
+};
+
+// Returns where the number of the token [first, last) starts.
+template <typename UC>
+fastfloat_really_inline FASTFLOAT_CONSTEXPR20 UC const *
+token_number_start(UC const *first, UC const *last,
+                   bool skip_white_space) noexcept {
+  if (skip_white_space) {
+    first = skip_spaces(first, last);
+  }
+  return first;
+}
+
+// Returns the first code unit of [p, last) that is not a separator, or last.
+// The white space, the default separators, is skipped with skip_spaces, which
+// is faster on long runs.
+template <typename UC>
+fastfloat_really_inline FASTFLOAT_CONSTEXPR20 UC const *
+skip_separators(UC const *p, UC const *last, separator_set separators,
+                bool white_space) noexcept {
+  if (white_space) {
+    return skip_spaces(p, last);
+  }
+  while ((p != last) && separators.contains(*p)) {
+    ++p;
+  }
+  return p;
+}
+
+constexpr bool is_white_space(separator_set separators) {
+  return separators.low == separator_set::white_space().low &&
+         separators.high == separator_set::white_space().high;
+}
+
+// Returns the end of the token that contains p, the next separator or last.
+template <typename UC>
+fastfloat_really_inline FASTFLOAT_CONSTEXPR14 UC const *
+token_end(UC const *p, UC const *last, separator_set separators) noexcept {
+  while ((p != last) && !separators.contains(*p)) {
+    ++p;
+  }
+  return p;
+}
+
+// Floating-point numbers are converted in batches of tokens, in two passes.
+// The first pass parses each token and converts it right away, with Clinger's
+// fast path or Eisel-Lemire: keeping these together lets the processor overlap
+// a conversion with the parsing of the next token. Numbers with more than 19
+// digits are converted right away too, since their parse already has all that
+// the full algorithm needs. The rare numbers that need parsing again (inf/nan,
+// or when Eisel-Lemire cannot decide the rounding) are set aside in a cold
+// list, and converted by the single-number code in a second pass, so that the
+// first pass stays tight.
+constexpr size_t parse_many_batch_size = 64;
+
+template <typename UC> struct cold_list {
+  size_t index[parse_many_batch_size];
+  UC const *first[parse_many_batch_size];
+  UC const *last[parse_many_batch_size];
+};
+
+// Parses the tokens of a bulk parse. The caller has adjusted options.format
+// for the feature macros. sixteen_digits selects the digit loops (see
+// loop_parse_if_eight_digits).
+template <size_t TypeIx> struct parse_many_caller {
+  static_assert(TypeIx > 0, "unsupported type");
+};
+
+template <> struct parse_many_caller<1> {
+  template <bool sixteen_digits, typename T, typename UC>
+  fastfloat_really_inline FASTFLOAT_CONSTEXPR20 static from_chars_many_result_t<
+      UC>
+  call(UC const *first, UC const *last, T *out, size_t max,
+       separator_set separators, parse_options_t<UC> options,
+       bool skip_white_space) noexcept {
+    if (uint64_t(options.format & chars_format::hex)) {
+      return call_hex(first, last, out, max, separators, options,
+                      skip_white_space);
+    }
+    bool const bjf = uint64_t(options.format & detail::basic_json_fmt) != 0;
+    bool const white_space = is_white_space(separators);
+    // The rounding mode is checked once for the whole buffer.
+    detail::rounding_known const rounding{!cpp20_and_in_constexpr() &&
+                                          detail::rounds_to_nearest()};
+    from_chars_many_result_t<UC> answer;
+    answer.ec = std::errc();
+    answer.count = 0;
+    cold_list<UC> cold;
+    UC const *p = first;
+    for (;;) {
+      T *values = out + answer.count;
+      size_t size = 0;
+      size_t cold_count = 0;
+      // The first error of the batch, if any.
+      size_t error_index = parse_many_batch_size;
+      UC const *error_ptr = last;
+      std::errc error = std::errc();
+      bool more = true;
+
+      // First pass: parse and convert, stopping at the first error. The
+      // number itself finds the end of its token, which must be a separator.
+      for (; size < parse_many_batch_size; ++size) {
+        p = skip_separators(p, last, separators, white_space);
+        if ((p == last) || (answer.count + size == max)) {
+          more = false;
+          break;
+        }
+        UC const *start = token_number_start(p, last, skip_white_space);
+        if (start == last) {
+          error = std::errc::invalid_argument;
+          break;
+        }
+        parsed_number_string_t<UC> const pns =
+            bjf ? parse_number_string<true, UC, sixteen_digits>(start, last,
+                                                                 options, false)
+                : parse_number_string<false, UC, sixteen_digits>(
+                      start, last, options, false);
+        if (!pns.valid) {
+          cold.index[cold_count] = size;
+          cold.first[cold_count] = p;
+          p = token_end(start, last, separators);
+          cold.last[cold_count++] = p;
+          continue;
+        }
+        if ((pns.lastmatch != last) && !separators.contains(*pns.lastmatch)) {
+          error = std::errc::invalid_argument;
+          break;
+        }
+        UC const *token_first = p;
+        p = pns.lastmatch;
+        if (pns.too_many_digits) {
+          // The parse has done the work of the slow path already.
+          parsed_number_string_t<UC> long_pns = pns;
+          if (from_chars_too_many_digits(long_pns, values[size],
+                                         options.digit_separator)
+                  .ec != std::errc()) {
+            p = token_first;
+            error = std::errc::result_out_of_range;
+            break;
+          }
+          continue;
+        }
+        if (clinger_fast_path_impl(pns.mantissa, pns.exponent, pns.negative,
+                                   values[size], rounding)) {
+          continue;
+        }
+        adjusted_mantissa const am =
+            compute_float<binary_format<T>>(pns.exponent, pns.mantissa);
+        if (am.power2 < 0) {
+          cold.index[cold_count] = size;
+          cold.first[cold_count] = token_first;
+          cold.last[cold_count++] = p;
+          continue;
+        }
+        to_float(pns.negative, am, values[size]);
+        if ((pns.mantissa != 0 && am.mantissa == 0 && am.power2 == 0) ||
+            am.power2 == binary_format<T>::infinite_power()) {
+          p = token_first;
+          error = std::errc::result_out_of_range;
+          break;
+        }
+      }
+      if (error != std::errc()) {
+        error_index = size;
+        error_ptr = p;
+        more = false;
+      }
+
+      // Second pass: the cold list, which is sorted by index.
+      for (size_t k = 0; k < cold_count; k++) {
+        UC const *start = token_number_start(cold.first[k], cold.last[k],
+                                             skip_white_space);
+        from_chars_result_t<UC> r;
+        if (start == cold.last[k]) {
+          r.ec = std::errc::invalid_argument;
+          r.ptr = start;
+        } else {
+          r = from_chars_float_prepared(start, cold.last[k],
+                                        values[cold.index[k]], options, bjf,
+                                        rounding);
+        }
+        if (r.ec != std::errc() || r.ptr != cold.last[k]) {
+          error_index = cold.index[k];
+          error_ptr = cold.first[k];
+          error = (r.ec != std::errc()) ? r.ec : std::errc::invalid_argument;
+          break;
+        }
+      }
+
+      if (error != std::errc()) {
+        answer.count += error_index;
+        answer.ec = error;
+        answer.ptr = error_ptr;
+        return answer;
+      }
+      answer.count += size;
+      if (!more) {
+        answer.ptr = p;
+        return answer;
+      }
+    }
+  }
+
+  // With chars_format::hex, the numbers are parsed one at a time, as the
+  // integers are, which keeps the test out of the decimal loop.
+  template <typename T, typename UC>
+  FASTFLOAT_CONSTEXPR20 static from_chars_many_result_t<UC>
+  call_hex(UC const *first, UC const *last, T *out, size_t max,
+           separator_set separators, parse_options_t<UC> options,
+           bool skip_white_space) noexcept {
+    bool const bjf = uint64_t(options.format & detail::basic_json_fmt) != 0;
+    bool const white_space = is_white_space(separators);
+    from_chars_many_result_t<UC> answer;
+    answer.ec = std::errc();
+    answer.count = 0;
+    UC const *p = first;
+    for (;;) {
+      p = skip_separators(p, last, separators, white_space);
+      if ((p == last) || (answer.count == max)) {
+        answer.ptr = p;
+        return answer;
+      }
+      UC const *start = token_number_start(p, last, skip_white_space);
+      from_chars_result_t<UC> r;
+      if (start == last) {
+        r.ec = std::errc::invalid_argument;
+        r.ptr = start;
+      } else {
+        r = from_chars_float_prepared(start, last, out[answer.count], options,
+                                      bjf);
+      }
+      // The number must span the whole token.
+      if (r.ec != std::errc() ||
+          ((r.ptr != last) && !separators.contains(*r.ptr))) {
+        answer.ec = (r.ec != std::errc()) ? r.ec : std::errc::invalid_argument;
+        answer.ptr = p;
+        return answer;
+      }
+      ++answer.count;
+      p = r.ptr;
+    }
+  }
+};
+
+template <> struct parse_many_caller<2> {
+  template <bool sixteen_digits, typename T, typename UC>
+  fastfloat_really_inline FASTFLOAT_CONSTEXPR20 static from_chars_many_result_t<
+      UC>
+  call(UC const *first, UC const *last, T *out, size_t max,
+       separator_set separators, parse_options_t<UC> options,
+       bool skip_white_space) noexcept {
+    bool const bad_base = options.base < 2 || options.base > 36;
+    bool const white_space = is_white_space(separators);
+    from_chars_many_result_t<UC> answer;
+    answer.ec = std::errc();
+    answer.count = 0;
+    UC const *p = first;
+    for (;;) {
+      p = skip_separators(p, last, separators, white_space);
+      if ((p == last) || (answer.count == max)) {
+        answer.ptr = p;
+        return answer;
+      }
+      UC const *start = token_number_start(p, last, skip_white_space);
+      from_chars_result_t<UC> r;
+      if (start == last || bad_base) {
+        r.ec = std::errc::invalid_argument;
+        r.ptr = start;
+      } else {
+        r = parse_int_string<T, UC, false, sixteen_digits>(
+            start, last, out[answer.count], options);
+      }
+      // The number must span the whole token.
+      if (r.ec != std::errc() ||
+          ((r.ptr != last) && !separators.contains(*r.ptr))) {
+        answer.ec = (r.ec != std::errc()) ? r.ec : std::errc::invalid_argument;
+        answer.ptr = p;
+        return answer;
+      }
+      ++answer.count;
+      p = r.ptr;
+    }
+  }
+};
+
+template <typename caller, typename T, typename UC>
+fastfloat_really_inline FASTFLOAT_CONSTEXPR20 from_chars_many_result_t<UC>
+parse_many_dispatch(UC const *first, UC const *last, T *out, size_t max,
+                    separator_set separators, parse_options_t<UC> options,
+                    bool skip_white_space) noexcept {
+  return caller::template call<sixteen_digit_loops>(
+      first, last, out, max, separators, options, skip_white_space);
+}
+
+#ifdef FASTFLOAT_X86_DISPATCH
+// The whole bulk parse is compiled for AVX2, so that the SSSE3 digit loops are
+// inlined into it.
+template <typename caller, typename T>
+FASTFLOAT_TARGET("avx2")
+from_chars_many_result_t<char> parse_many_avx2(
+    char const *first, char const *last, T *out, size_t max,
+    separator_set separators, parse_options_t<char> options,
+    bool skip_white_space) noexcept {
+  return caller::template call<true>(first, last, out, max, separators,
+                                     options, skip_white_space);
+}
+
+template <typename caller, typename T>
+FASTFLOAT_CONSTEXPR20 from_chars_many_result_t<char>
+parse_many_dispatch(char const *first, char const *last, T *out, size_t max,
+                    separator_set separators, parse_options_t<char> options,
+                    bool skip_white_space) noexcept {
+  if (!cpp20_and_in_constexpr()) {
+    switch (active_simd_kernel()) {
+    case simd_kernel::avx512:
+    case simd_kernel::avx2:
+      return parse_many_avx2<caller>(first, last, out, max, separators,
+                                     options, skip_white_space);
+    default:
+      // SSE2 has no faster digit loops than the scalar ones.
+      return caller::template call<false>(first, last, out, max, separators,
+                                          options, skip_white_space);
+    }
+  }
+  return caller::template call<sixteen_digit_loops>(
+      first, last, out, max, separators, options, skip_white_space);
+}
+#endif
+
+} // namespace detail
+
+template <typename T, typename UC>
+FASTFLOAT_CONSTEXPR20 from_chars_many_result_t<UC>
+from_chars_many(UC const *first, UC const *last, T *out, size_t max,
+                separator_set separators,
+                parse_options_t<UC> options) noexcept {
+  static_assert(is_supported_float_type<T>::value ||
+                    is_supported_integer_type<T>::value,
+                "only integer and floating-point types are supported");
+  static_assert(is_supported_char_type<UC>::value,
+                "only char, wchar_t, char16_t and char32_t are supported");
+  using caller = detail::parse_many_caller<
+      size_t(is_supported_float_type<T>::value) +
+      2 * size_t(is_supported_integer_type<T>::value)>;
+
+  // Per-call setup of from_chars_advanced, hoisted out of the loop.
+  options.format = detail::adjust_for_feature_macros(options.format);
+  bool const skip_white_space =
+      uint64_t(options.format & chars_format::skip_white_space) != 0;
+  return detail::parse_many_dispatch<caller>(first, last, out, max, separators,
+                                             options, skip_white_space);
+}
+
+} // namespace fast_float
+
+#endif
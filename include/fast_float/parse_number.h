@@ -188,26 +188,15 @@ from_chars(UC const *first, UC const *last, T &value,
                                     parse_options_t<UC>(fmt));
 }
 
+// Clinger's fast path, where `rounds_to_nearest` tells whether the system
+// rounds to nearest: bulk functions query the rounding mode once for all values.
 template <typename T>
 fastfloat_really_inline FASTFLOAT_CONSTEXPR20 bool
 clinger_fast_path_impl(uint64_t mantissa, int64_t exponent, bool is_negative,
-                       T &value) noexcept {
-  // The implementation of the Clinger's fast path is convoluted because
-  // we want round-to-nearest in all cases, irrespective of the rounding mode
-  // selected on the thread.
-  // We proceed optimistically, assuming that detail::rounds_to_nearest()
-  // returns true.
+                       T &value, bool rounds_to_nearest) noexcept {
   if (binary_format<T>::min_exponent_fast_path() <= exponent &&
       exponent <= binary_format<T>::max_exponent_fast_path()) {
-    // Unfortunately, the conventional Clinger's fast path is only possible
-    // when the system rounds to the nearest float.
-    //
-    // We expect the next branch to almost always be selected.
-    // We could check it first (before the previous branch), but
-    // there might be performance advantages at having the check
-    // be last.
-    if (!cpp20_and_in_constexpr() && detail::rounds_to_nearest()) {
-      // We have that fegetround() == FE_TONEAREST.
+    if (rounds_to_nearest) {
       // Next is Clinger's fast path.
       if (mantissa <= binary_format<T>::max_mantissa_fast_path()) {
         value = T(mantissa);
@@ -222,7 +211,6 @@ clinger_fast_path_impl(uint64_t mantissa, int64_t exponent, bool is_negative,
         return true;
       }
     } else {
-      // We do not have that fegetround() == FE_TONEAREST.
       // Next is a modified Clinger's fast path, inspired by Jakub Jelínek's
       // proposal
       if (exponent >= 0 &&
@@ -245,6 +233,57 @@ clinger_fast_path_impl(uint64_t mantissa, int64_t exponent, bool is_negative,
   return false;
 }
 
+template <typename T>
+fastfloat_really_inline FASTFLOAT_CONSTEXPR20 bool
+clinger_fast_path_impl(uint64_t mantissa, int64_t exponent, bool is_negative,
+                       T &value) noexcept {
+  // The implementation of the Clinger's fast path is convoluted because
+  // we want round-to-nearest in all cases, irrespective of the rounding mode
+  // selected on the thread.
+  // We proceed optimistically, assuming that detail::rounds_to_nearest()
+  // returns true.
+  if (binary_format<T>::min_exponent_fast_path() <= exponent &&
+      exponent <= binary_format<T>::max_exponent_fast_path()) {
+    // Unfortunately, the conventional Clinger's fast path is only possible
+    // when the system rounds to the nearest float.
+    //
+    // We expect the rounding mode to almost always be to nearest.
+    // We could check it first (before the previous branch), but
+    // there might be performance advantages at having the check
+    // be last.
+    return clinger_fast_path_impl(
+        mantissa, exponent, is_negative, value,
+        !cpp20_and_in_constexpr() && detail::rounds_to_nearest());
+  }
+  return false;
+}
+
+// How from_chars_float_prepared learns the rounding mode: by checking it when
+// Clinger's fast path applies (the default), or from the caller, which checked
+// it once beforehand (bulk functions and parse_context).
+namespace detail {
+struct rounding_checked {};
+
+struct rounding_known {
+  bool nearest;
+};
+} // namespace detail
+
+template <typename T>
+fastfloat_really_inline FASTFLOAT_CONSTEXPR20 bool
+clinger_fast_path_impl(uint64_t mantissa, int64_t exponent, bool is_negative,
+                       T &value, detail::rounding_checked) noexcept {
+  return clinger_fast_path_impl(mantissa, exponent, is_negative, value);
+}
+
+template <typename T>
+fastfloat_really_inline FASTFLOAT_CONSTEXPR20 bool
+clinger_fast_path_impl(uint64_t mantissa, int64_t exponent, bool is_negative,
+                       T &value, detail::rounding_known rounding) noexcept {
+  return clinger_fast_path_impl(mantissa, exponent, is_negative, value,
+                                rounding.nearest);
+}
+
 /**
  * This function overload takes parsed_number_string_t structure that is created
  * and populated either by from_chars_advanced function taking chars range and
@@ -271,7 +310,11 @@ from_chars_advanced(parsed_number_string_t<UC> &pns, T &value) noexcept {
       compute_float<binary_format<T>>(pns.exponent, pns.mantissa);
   if (pns.too_many_digits && am.power2 >= 0) {
     if (am != compute_float<binary_format<T>>(pns.exponent, pns.mantissa + 1)) {
-      am = compute_error<binary_format<T>>(pns.exponent, pns.mantissa);
+      // 19 digits cannot decide: try 38 digits, in 128 bits.
+      am = long_mantissa_comp<T>(pns);
+      if (am.power2 < 0) {
+        am = compute_error<binary_format<T>>(pns.exponent, pns.mantissa);
+      }
     }
   }
   // If we called compute_float<binary_format<T>>(pns.exponent, pns.mantissa)
@@ -289,47 +332,182 @@ from_chars_advanced(parsed_number_string_t<UC> &pns, T &value) noexcept {
   return answer;
 }
 
-// Slow path: re-parse materializing the integer/fraction spans the hot no-span
-// parse skipped, then run the full algorithm. The two callers reach it only
-// through a fastfloat_unlikely branch, so the optimizer keeps this re-parse off
-// the hot path on its own (no function-level noinline needed).
-// from_chars_advanced already handles both the too_many_digits disambiguation
-// and the am.power2<0 digit_comp recompute, so both slow branches collapse to
-// one helper call.
+// With digit separators, the spans include them, while digit_comp reads the
+// spans as digits: the digits are then copied without the separators (at most
+// as many as digit_comp reads, and then a 1 for the other nonzero digits).
 template <typename T, typename UC>
 FASTFLOAT_CONSTEXPR20 from_chars_result_t<UC>
+from_chars_separated_digits(parsed_number_string_t<UC> pns, UC separator,
+                            T &value) noexcept {
+  constexpr size_t max_digits = binary_format<T>::max_digits();
+  UC digits[max_digits + 1] = {};
+  size_t count = 0;
+  span<UC const> const parts[] = {pns.integer, pns.fraction};
+  for (span<UC const> const &part : parts) {
+    for (size_t k = 0; (k < part.len()) && (count <= max_digits); k++) {
+      UC const c = part[k];
+      if ((c == separator) || ((count == 0) && (c == UC('0')))) {
+        continue;
+      }
+      if (count < max_digits) {
+        digits[count++] = c;
+      } else if (c != UC('0')) {
+        digits[count++] = UC('1');
+      }
+    }
+  }
+  pns.integer = span<UC const>(digits, count);
+  pns.fraction = span<UC const>();
+  return from_chars_advanced(pns, value);
+}
+
+// Slow path: re-parse materializing the integer/fraction spans the hot no-span
+// parse skipped, then run the full algorithm (the am.power2<0 digit_comp
+// recompute). The caller reaches it only through a fastfloat_unlikely branch,
+// so the optimizer keeps this re-parse off the hot path on its own (no
+// function-level noinline needed).
+template <typename T, typename UC, typename Options>
+FASTFLOAT_CONSTEXPR20 from_chars_result_t<UC>
 parse_number_slow_path(UC const *first, UC const *last, T &value,
-                       parse_options_t<UC> options, bool bjf) noexcept {
+                       Options options, bool bjf) noexcept {
   parsed_number_string_t<UC> pns =
       bjf ? parse_number_string<true, UC>(first, last, options, true)
           : parse_number_string<false, UC>(first, last, options, true);
+  if (options.digit_separator != UC(0)) {
+    return from_chars_separated_digits(pns, UC(options.digit_separator),
+                                       value);
+  }
   return from_chars_advanced(pns, value);
 }
 
+// Slow path for more than 19 significant digits: parse_number_string has
+// already truncated the mantissa and materialized the spans, so this does not
+// parse again. It is a separate function so that the full algorithm stays off
+// the hot path. `separator` is the digit separator of the options, if any.
 template <typename T, typename UC>
-fastfloat_really_inline FASTFLOAT_CONSTEXPR20 from_chars_result_t<UC>
-from_chars_float_advanced(UC const *first, UC const *last, T &value,
-                          parse_options_t<UC> options) noexcept {
-
-  static_assert(is_supported_float_type<T>::value,
-                "only some floating-point types are supported");
-  static_assert(is_supported_char_type<UC>::value,
-                "only char, wchar_t, char16_t and char32_t are supported");
+FASTFLOAT_CONSTEXPR20 from_chars_result_t<UC>
+from_chars_too_many_digits(parsed_number_string_t<UC> &pns, T &value,
+                           UC separator) noexcept {
+  if (separator != UC(0)) {
+    return from_chars_separated_digits(pns, separator, value);
+  }
+  return from_chars_advanced(pns, value);
+}
 
-  chars_format const fmt = detail::adjust_for_feature_macros(options.format);
+// The value of mantissa * 2^exponent, rounded to nearest, ties to even, when
+// `inexact` tells that the value is a little greater. The mantissa and the
+// exponent are binary, so no decimal machinery is needed.
+template <typename T>
+fastfloat_really_inline FASTFLOAT_CONSTEXPR20 adjusted_mantissa
+hex_to_adjusted_mantissa(uint64_t mantissa, int64_t exponent,
+                         bool inexact) noexcept {
+  adjusted_mantissa answer;
+  answer.mantissa = 0;
+  answer.power2 = 0;
+  if (mantissa == 0) {
+    return answer;
+  }
+  int const lz = leading_zeroes(mantissa);
+  mantissa <<= lz;
+  // The value is in [2^(exponent + 63 - lz), 2^(exponent + 64 - lz)).
+  int64_t power2 = exponent + 63 - lz - binary_format<T>::minimum_exponent();
+  int const bits = binary_format<T>::mantissa_explicit_bits() + 1;
+  int64_t shift = 64 - bits;
+  if (power2 <= 0) {
+    // Subnormal: fewer bits are kept.
+    shift += 1 - power2;
+    power2 = 0;
+  }
+  if (power2 >= binary_format<T>::infinite_power()) {
+    answer.power2 = binary_format<T>::infinite_power();
+    return answer;
+  }
+  if (shift > 64) {
+    // Less than half of the smallest subnormal.
+    return answer;
+  }
+  uint64_t truncated = (shift == 64) ? 0 : mantissa >> shift;
+  // The bits shifted out, at the top.
+  uint64_t const remainder =
+      (shift == 64) ? mantissa : mantissa << (64 - shift);
+  uint64_t const half = uint64_t(1) << 63;
+  if ((remainder > half) ||
+      ((remainder == half) && (inexact || (truncated & 1)))) {
+    ++truncated;
+  }
+  uint64_t const hidden_bit = uint64_t(1) << (bits - 1);
+  if (truncated == (hidden_bit << 1)) {
+    truncated >>= 1;
+    ++power2;
+    if (power2 >= binary_format<T>::infinite_power()) {
+      answer.power2 = binary_format<T>::infinite_power();
+      return answer;
+    }
+  } else if ((power2 == 0) && (truncated >= hidden_bit)) {
+    // A subnormal rounded up to the smallest normal number.
+    power2 = 1;
+  }
+  answer.mantissa = truncated & ~hidden_bit;
+  answer.power2 = int32_t(power2);
+  return answer;
+}
 
-  from_chars_result_t<UC> answer;
-  if (uint64_t(fmt & chars_format::skip_white_space)) {
-    while ((first != last) && fast_float::is_space(*first)) {
-      first++;
+// Parses a hexadecimal number when the format has chars_format::hex: alone, the
+// numbers are hexadecimal, as with std::from_chars; with the fixed or the
+// scientific format, only those with the "0x" prefix are. Returns false when
+// the number is left to the decimal parser. It is not forced inline, to keep
+// the decimal hot path small.
+template <typename T, typename UC, typename Options>
+FASTFLOAT_CONSTEXPR20 bool
+from_chars_hex_float(UC const *first, UC const *last, T &value, Options options,
+                     from_chars_result_t<UC> &answer) noexcept {
+  chars_format const fmt = options.format;
+  bool const hex_only = !uint64_t(fmt & chars_format::general);
+  parsed_hex_string_t<UC> const phs =
+      parse_hex_number_string(first, last, options, !hex_only);
+  if (!phs.valid) {
+    if (!hex_only) {
+      // No "0x", or no digits after it: the decimal parser reads the number
+      // (or the "0").
+      return false;
     }
+    if (uint64_t(fmt & chars_format::no_infnan)) {
+      answer.ec = std::errc::invalid_argument;
+      answer.ptr = first;
+    } else {
+      answer = detail::parse_infnan(first, last, value, fmt);
+    }
+    return true;
   }
-  if (first == last) {
-    answer.ec = std::errc::invalid_argument;
-    answer.ptr = first;
+  adjusted_mantissa const am =
+      hex_to_adjusted_mantissa<T>(phs.mantissa, phs.exponent, phs.inexact);
+  to_float(phs.negative, am, value);
+  answer.ec = std::errc();
+  answer.ptr = phs.lastmatch;
+  // Test for over/underflow.
+  if ((phs.mantissa != 0 && am.mantissa == 0 && am.power2 == 0) ||
+      am.power2 == binary_format<T>::infinite_power()) {
+    answer.ec = std::errc::result_out_of_range;
+  }
+  return true;
+}
+
+// The part of from_chars_float_advanced that follows the per-call setup: the
+// format in `options` is already adjusted for the feature macros, the white
+// space is skipped and first != last. Bulk parsers do that setup only once.
+template <typename T, typename UC, typename Options,
+          typename Rounding = detail::rounding_checked>
+fastfloat_really_inline FASTFLOAT_CONSTEXPR20 from_chars_result_t<UC>
+from_chars_float_prepared(UC const *first, UC const *last, T &value,
+                          Options options, bool bjf,
+                          Rounding rounding = Rounding()) noexcept {
+  chars_format const fmt = options.format;
+  from_chars_result_t<UC> answer;
+
+  if (uint64_t(fmt & chars_format::hex) &&
+      from_chars_hex_float(first, last, value, options, answer)) {
     return answer;
   }
-  bool const bjf = uint64_t(fmt & detail::basic_json_fmt) != 0;
 
   // Fast path: parse WITHOUT materializing the integer/fraction spans (read
   // only by the rare slow paths). Skipping their stores keeps the fat
@@ -348,9 +526,8 @@ from_chars_float_advanced(UC const *first, UC const *last, T &value,
     }
   }
 
-  // Slow path A (rare): > 19 significant digits. The no-span parse left the
-  // mantissa un-truncated and skipped the span-based recompute; the cold helper
-  // re-parses with spans and runs the full algorithm.
+  // Slow path A (rare): > 19 significant digits. The parse has truncated the
+  // mantissa and set the spans; the cold helper runs the full algorithm.
   //
 // We have to disable -Wc++20-extensions for the [[unlikely]] attribute
 // See comment for @jwakely at
@@ -363,12 +540,14 @@ from_chars_float_advanced(UC const *first, UC const *last, T &value,
 #endif
 #endif
   if fastfloat_unlikely (pns.too_many_digits) {
-    return parse_number_slow_path<T, UC>(first, last, value, options, bjf);
+    return from_chars_too_many_digits(pns, value,
+                                      UC(options.digit_separator));
   }
   answer.ec = std::errc(); // be optimistic
   answer.ptr = pns.lastmatch;
 
-  if (clinger_fast_path_impl(pns.mantissa, pns.exponent, pns.negative, value)) {
+  if (clinger_fast_path_impl(pns.mantissa, pns.exponent, pns.negative, value,
+                             rounding)) {
     return answer;
   }
 
@@ -393,6 +572,32 @@ from_chars_float_advanced(UC const *first, UC const *last, T &value,
   return answer;
 }
 
+template <typename T, typename UC, typename Options>
+fastfloat_really_inline FASTFLOAT_CONSTEXPR20 from_chars_result_t<UC>
+from_chars_float_advanced(UC const *first, UC const *last, T &value,
+                          Options options) noexcept {
+
+  static_assert(is_supported_float_type<T>::value,
+                "only some floating-point types are supported");
+  static_assert(is_supported_char_type<UC>::value,
+                "only char, wchar_t, char16_t and char32_t are supported");
+
+  chars_format const fmt = detail::adjust_for_feature_macros(options.format);
+
+  if (uint64_t(fmt & chars_format::skip_white_space)) {
+    first = skip_spaces(first, last);
+  }
+  if (first == last) {
+    from_chars_result_t<UC> answer;
+    answer.ec = std::errc::invalid_argument;
+    answer.ptr = first;
+    return answer;
+  }
+  bool const bjf = uint64_t(fmt & detail::basic_json_fmt) != 0;
+  return from_chars_float_prepared(
+      first, last, value, detail::adjust_for_feature_macros(options), bjf);
+}
+
 template <typename T, typename UC, typename>
 FASTFLOAT_CONSTEXPR20 from_chars_result_t<UC>
 from_chars(UC const *first, UC const *last, T &value, int base) noexcept {
@@ -485,10 +690,102 @@ integer_times_pow10(Int mantissa, int decimal_exponent) noexcept {
   return integer_times_pow10(static_cast<int64_t>(mantissa), decimal_exponent);
 }
 
-template <typename T, typename UC>
+namespace detail {
+// One value of integer_times_pow10_many.
+template <typename T>
+fastfloat_really_inline FASTFLOAT_CONSTEXPR20 T
+integer_times_pow10_one(int64_t mantissa, int decimal_exponent,
+                        bool rounds_to_nearest) noexcept {
+  uint64_t const limit = binary_format<T>::max_mantissa_fast_path();
+  if (rounds_to_nearest &&
+      decimal_exponent >= binary_format<T>::min_exponent_fast_path() &&
+      decimal_exponent <= binary_format<T>::max_exponent_fast_path() &&
+      uint64_t(mantissa) + limit <= 2 * limit) {
+    // Clinger's fast path, on the signed mantissa to avoid a branch on the
+    // sign: both rounding to nearest, the results are the same.
+    return (decimal_exponent < 0)
+               ? T(mantissa) /
+                     binary_format<T>::exact_power_of_ten(-decimal_exponent)
+               : T(mantissa) *
+                     binary_format<T>::exact_power_of_ten(decimal_exponent);
+  }
+  bool const is_negative = mantissa < 0;
+  uint64_t const m =
+      is_negative ? uint64_t(0) - uint64_t(mantissa) : uint64_t(mantissa);
+  T value;
+  if (clinger_fast_path_impl(m, decimal_exponent, is_negative, value,
+                             rounds_to_nearest)) {
+    return value;
+  }
+  adjusted_mantissa const am =
+      compute_float<binary_format<T>>(decimal_exponent, m);
+  to_float(is_negative, am, value);
+  return value;
+}
+} // namespace detail
+
+template <typename T>
+FASTFLOAT_CONSTEXPR20
+    typename std::enable_if<is_supported_float_type<T>::value>::type
+    integer_times_pow10_many(int64_t const *mantissa,
+                             int const *decimal_exponent, T *out,
+                             size_t count) noexcept {
+  bool const nearest =
+      !cpp20_and_in_constexpr() && detail::rounds_to_nearest();
+  for (size_t i = 0; i < count; i++) {
+    out[i] = detail::integer_times_pow10_one<T>(mantissa[i],
+                                                decimal_exponent[i], nearest);
+  }
+}
+
+template <typename T>
+FASTFLOAT_CONSTEXPR20
+    typename std::enable_if<is_supported_float_type<T>::value>::type
+    integer_times_pow10_many(int64_t const *mantissa, int decimal_exponent,
+                             T *out, size_t count) noexcept {
+  bool const nearest =
+      !cpp20_and_in_constexpr() && detail::rounds_to_nearest();
+  if (!nearest ||
+      decimal_exponent < binary_format<T>::min_exponent_fast_path() ||
+      decimal_exponent > binary_format<T>::max_exponent_fast_path()) {
+    for (size_t i = 0; i < count; i++) {
+      out[i] = detail::integer_times_pow10_one<T>(mantissa[i],
+                                                  decimal_exponent, nearest);
+    }
+    return;
+  }
+  // Clinger's fast path for all the values at once, in branchless loops that
+  // the compiler can vectorize. The mantissas that are too large for it are
+  // rare, and their values are computed again.
+  uint64_t const limit = binary_format<T>::max_mantissa_fast_path();
+  uint64_t too_large = 0;
+  if (decimal_exponent < 0) {
+    T const power = binary_format<T>::exact_power_of_ten(-decimal_exponent);
+    for (size_t i = 0; i < count; i++) {
+      out[i] = T(mantissa[i]) / power;
+      too_large |= uint64_t(uint64_t(mantissa[i]) + limit > 2 * limit);
+    }
+  } else {
+    T const power = binary_format<T>::exact_power_of_ten(decimal_exponent);
+    for (size_t i = 0; i < count; i++) {
+      out[i] = T(mantissa[i]) * power;
+      too_large |= uint64_t(uint64_t(mantissa[i]) + limit > 2 * limit);
+    }
+  }
+  if (too_large != 0) {
+    for (size_t i = 0; i < count; i++) {
+      if (uint64_t(mantissa[i]) + limit > 2 * limit) {
+        out[i] = detail::integer_times_pow10_one<T>(
+            mantissa[i], decimal_exponent, nearest);
+      }
+    }
+  }
+}
+
+template <typename T, typename UC, bool padded = false, typename Options>
 FASTFLOAT_CONSTEXPR20 from_chars_result_t<UC>
 from_chars_int_advanced(UC const *first, UC const *last, T &value,
-                        parse_options_t<UC> options) noexcept {
+                        Options options) noexcept {
 
   static_assert(is_supported_integer_type<T>::value,
                 "only integer types are supported");
@@ -500,9 +797,7 @@ from_chars_int_advanced(UC const *first, UC const *last, T &value,
 
   from_chars_result_t<UC> answer;
   if (uint64_t(fmt & chars_format::skip_white_space)) {
-    while ((first != last) && fast_float::is_space(*first)) {
-      first++;
-    }
+    first = skip_spaces(first, last);
   }
   if (first == last || base < 2 || base > 36) {
     answer.ec = std::errc::invalid_argument;
@@ -510,7 +805,7 @@ from_chars_int_advanced(UC const *first, UC const *last, T &value,
     return answer;
   }
 
-  return parse_int_string(first, last, value, options);
+  return parse_int_string<T, UC, padded>(first, last, value, options);
 }
 
 template <size_t TypeIx> struct from_chars_advanced_caller {
@@ -518,20 +813,20 @@ template <size_t TypeIx> struct from_chars_advanced_caller {
 };
 
 template <> struct from_chars_advanced_caller<1> {
-  template <typename T, typename UC>
+  // The padding does not help with floating-point numbers: their digit runs
+  // are short and the existing loops are as fast as eight-digit reads.
+  template <bool padded = false, typename T, typename UC, typename Options>
   fastfloat_really_inline FASTFLOAT_CONSTEXPR20 static from_chars_result_t<UC>
-  call(UC const *first, UC const *last, T &value,
-       parse_options_t<UC> options) noexcept {
+  call(UC const *first, UC const *last, T &value, Options options) noexcept {
     return from_chars_float_advanced(first, last, value, options);
   }
 };
 
 template <> struct from_chars_advanced_caller<2> {
-  template <typename T, typename UC>
+  template <bool padded = false, typename T, typename UC, typename Options>
   fastfloat_really_inline FASTFLOAT_CONSTEXPR20 static from_chars_result_t<UC>
-  call(UC const *first, UC const *last, T &value,
-       parse_options_t<UC> options) noexcept {
-    return from_chars_int_advanced(first, last, value, options);
+  call(UC const *first, UC const *last, T &value, Options options) noexcept {
+    return from_chars_int_advanced<T, UC, padded>(first, last, value, options);
   }
 };
 
@@ -545,6 +840,27 @@ from_chars_advanced(UC const *first, UC const *last, T &value,
                                                              options);
 }
 
+template <typename T, typename UC>
+FASTFLOAT_CONSTEXPR20 from_chars_result_t<UC>
+from_chars_padded(UC const *first, UC const *last, T &value,
+                  parse_options_t<UC> options) noexcept {
+  return from_chars_advanced_caller<
+      size_t(is_supported_float_type<T>::value) +
+      2 * size_t(is_supported_integer_type<T>::value)>::template call<true>(
+      first, last, value, options);
+}
+
+template <typename T, chars_format Fmt, char DecimalPoint, int Base,
+          typename UC>
+FASTFLOAT_CONSTEXPR20 from_chars_result_t<UC>
+from_chars(UC const *first, UC const *last, T &value) noexcept {
+  return from_chars_advanced_caller<
+      size_t(is_supported_float_type<T>::value) +
+      2 * size_t(is_supported_integer_type<T>::value)>::
+      call(first, last, value,
+           detail::constant_parse_options<UC, Fmt, DecimalPoint, Base>());
+}
+
 } // namespace fast_float
 
 #endif
@@ -0,0 +1,240 @@
+#ifndef FASTFLOAT_PARSE_REDUCE_H
+#define FASTFLOAT_PARSE_REDUCE_H
+
+#include "float_common.h"
+#include "parse_many.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <system_error>
+#include <type_traits>
+
+namespace fast_float {
+
+/**
+ * A reducer for `parse_reduce` that sums the values and counts them. For
+ * floating-point types, the sum has Kahan compensation: the rounding error of
+ * each addition is carried into the next one, so that the sum of many values is
+ * about as accurate as if it had been computed with twice the precision. For
+ * integer types, the sum is computed in `T` and must not overflow it (e.g.,
+ * parse 32-bit values as `int64_t`).
+ */
+template <typename T, bool = is_supported_float_type<T>::value>
+class sum_reducer {
+public:
+  using value_type = T;
+
+  constexpr sum_reducer() noexcept : total(0), compensation(0), plain(0), n(0) {}
+
+  FASTFLOAT_CONSTEXPR14 void operator()(T x) noexcept {
+    T const y = x - compensation;
+    T const t = total + y;
+    compensation = (t - total) - y;
+    total = t;
+    plain += x;
+    ++n;
+  }
+
+  constexpr T sum() const noexcept {
+    // With infinities or NaNs, the compensation is a NaN: the plain sum is
+    // then the answer.
+    return (plain - plain == 0) ? total : plain;
+  }
+
+  constexpr T mean() const noexcept { return sum() / T(n); }
+
+  constexpr size_t count() const noexcept { return n; }
+
+private:
+  T total;
+  T compensation;
+  T plain;
+  size_t n;
+};
+
+template <typename T> class sum_reducer<T, false> {
+public:
+  using value_type = T;
+
+  constexpr sum_reducer() noexcept : total(0), n(0) {}
+
+  FASTFLOAT_CONSTEXPR14 void operator()(T x) noexcept {
+    total += x;
+    ++n;
+  }
+
+  constexpr T sum() const noexcept { return total; }
+
+  constexpr double mean() const noexcept { return double(total) / double(n); }
+
+  constexpr size_t count() const noexcept { return n; }
+
+private:
+  T total;
+  size_t n;
+};
+
+/**
+ * A reducer for `parse_reduce` that keeps the smallest value. It is +infinity
+ * (or the largest value of an integer type) when there are none, and NaNs are
+ * ignored.
+ */
+template <typename T> class min_reducer {
+public:
+  using value_type = T;
+
+  constexpr min_reducer() noexcept
+      : smallest(std::numeric_limits<T>::has_infinity
+                     ? std::numeric_limits<T>::infinity()
+                     : (std::numeric_limits<T>::max)()) {}
+
+  FASTFLOAT_CONSTEXPR14 void operator()(T x) noexcept {
+    smallest = (x < smallest) ? x : smallest;
+  }
+
+  constexpr T min() const noexcept { return smallest; }
+
+private:
+  T smallest;
+};
+
+/**
+ * A reducer for `parse_reduce` that keeps the largest value. It is -infinity
+ * (or the smallest value of an integer type) when there are none, and NaNs are
+ * ignored.
+ */
+template <typename T> class max_reducer {
+public:
+  using value_type = T;
+
+  constexpr max_reducer() noexcept
+      : largest(std::numeric_limits<T>::has_infinity
+                    ? -std::numeric_limits<T>::infinity()
+                    : (std::numeric_limits<T>::min)()) {}
+
+  FASTFLOAT_CONSTEXPR14 void operator()(T x) noexcept {
+    largest = (largest < x) ? x : largest;
+  }
+
+  constexpr T max() const noexcept { return largest; }
+
+private:
+  T largest;
+};
+
+/**
+ * A reducer for `parse_reduce` that counts the values, e.g., to validate a
+ * file of numbers: each of them is still parsed.
+ */
+template <typename T> class count_reducer {
+public:
+  using value_type = T;
+
+  constexpr count_reducer() noexcept : n(0) {}
+
+  FASTFLOAT_CONSTEXPR14 void operator()(T) noexcept { ++n; }
+
+  constexpr size_t count() const noexcept { return n; }
+
+private:
+  size_t n;
+};
+
+/**
+ * A reducer for `parse_reduce` that counts the values in each of `Buckets`
+ * buckets of the same width, from `low` to `high`. The values below `low` are
+ * counted by `underflow()`, and those from `high` up, and the NaNs, by
+ * `overflow()`.
+ */
+template <typename T, size_t Buckets> class histogram_reducer {
+  static_assert(Buckets > 0, "a histogram needs a bucket");
+
+public:
+  using value_type = T;
+
+  constexpr histogram_reducer(T low_, T high_) noexcept
+      : low(low_), high(high_),
+        scale(double(Buckets) / (double(high_) - double(low_))), counts{},
+        below(0), above(0) {}
+
+  FASTFLOAT_CONSTEXPR14 void operator()(T x) noexcept {
+    if (x < low) {
+      ++below;
+    } else if (!(x < high)) {
+      ++above;
+    } else {
+      size_t i = size_t((double(x) - double(low)) * scale);
+      // The product may round up to Buckets.
+      i = (i < Buckets) ? i : Buckets - 1;
+      ++counts[i];
+    }
+  }
+
+  /** The number of values in [low + i * width, low + (i + 1) * width) */
+  constexpr uint64_t count(size_t i) const noexcept { return counts[i]; }
+
+  constexpr uint64_t underflow() const noexcept { return below; }
+
+  constexpr uint64_t overflow() const noexcept { return above; }
+
+  static constexpr size_t size() noexcept { return Buckets; }
+
+private:
+  T low;
+  T high;
+  double scale;
+  uint64_t counts[Buckets];
+  uint64_t below;
+  uint64_t above;
+};
+
+template <typename Reducer, typename UC>
+FASTFLOAT_CONSTEXPR20 from_chars_many_result_t<UC>
+parse_reduce(UC const *first, UC const *last, separator_set separators,
+             Reducer &reducer, parse_options_t<UC> options) noexcept {
+  using T = typename Reducer::value_type;
+  static_assert(is_supported_float_type<T>::value ||
+                    is_supported_integer_type<T>::value,
+                "only integer and floating-point types are supported");
+  static_assert(is_supported_char_type<UC>::value,
+                "only char, wchar_t, char16_t and char32_t are supported");
+  using caller = detail::parse_many_caller<
+      size_t(is_supported_float_type<T>::value) +
+      2 * size_t(is_supported_integer_type<T>::value)>;
+
+  options.format = detail::adjust_for_feature_macros(options.format);
+  bool const skip_white_space =
+      uint64_t(options.format & chars_format::skip_white_space) != 0;
+  // The bulk parse fills one batch at a time, which stays in the L1 cache, and
+  // the values are folded into a copy of the reducer, which the compiler can
+  // keep in registers.
+  Reducer local = reducer;
+  T values[detail::parse_many_batch_size];
+  from_chars_many_result_t<UC> answer;
+  answer.ec = std::errc();
+  answer.count = 0;
+  answer.ptr = first;
+  for (;;) {
+    from_chars_many_result_t<UC> const batch =
+        detail::parse_many_dispatch<caller>(
+            answer.ptr, last, values, detail::parse_many_batch_size,
+            separators, options, skip_white_space);
+    for (size_t i = 0; i < batch.count; i++) {
+      local(values[i]);
+    }
+    answer.count += batch.count;
+    answer.ptr = batch.ptr;
+    answer.ec = batch.ec;
+    if ((batch.ec != std::errc()) ||
+        (batch.count < detail::parse_many_batch_size) || (batch.ptr == last)) {
+      break;
+    }
+  }
+  reducer = local;
+  return answer;
+}
+
+} // namespace fast_float
+
+#endif
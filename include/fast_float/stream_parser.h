@@ -0,0 +1,166 @@
+#ifndef FASTFLOAT_STREAM_PARSER_H
+#define FASTFLOAT_STREAM_PARSER_H
+
+#include "float_common.h"
+#include "parse_many.h"
+
+#include <cstddef>
+#include <system_error>
+
+namespace fast_float {
+
+namespace detail {
+constexpr size_t stream_max_split_length = 256;
+} // namespace detail
+
+/**
+ * Parses a stream of separated numbers that arrives in blocks (e.g., the reads
+ * of a file or a socket), where a number may be split between two blocks. The
+ * numbers are separated as with `from_chars_many`, and parsed using the given
+ * `options`.
+ *
+ * Each call to `feed` parses the numbers of the next block that are complete:
+ * the number at the end of the block, which may continue in the next block, is
+ * kept in the parser (at most `max_split_length()` code units) and completed by
+ * the next call. At the end of the stream, `finish` parses that last number.
+ * The caller never needs to keep or copy the blocks.
+ *
+ * The implementation does not throw and does not allocate memory.
+ */
+template <typename T, typename UC = char> class stream_parser {
+  static_assert(is_supported_float_type<T>::value ||
+                    is_supported_integer_type<T>::value,
+                "only integer and floating-point types are supported");
+  static_assert(is_supported_char_type<UC>::value,
+                "only char, wchar_t, char16_t and char32_t are supported");
+
+public:
+  FASTFLOAT_CONSTEXPR20 explicit stream_parser(
+      separator_set separators = separator_set::white_space(),
+      parse_options_t<UC> options = parse_options_t<UC>()) noexcept
+      : set(separators), parse_options(options), pending{}, pending_length(0) {}
+
+  // The longest number that may be split between blocks.
+  static constexpr size_t max_split_length() noexcept {
+    return detail::stream_max_split_length;
+  }
+
+  // Whether the last block ended with an incomplete number.
+  constexpr bool has_pending() const noexcept { return pending_length != 0; }
+
+  // Drops the incomplete number, if any, e.g., to start a new stream.
+  FASTFLOAT_CONSTEXPR14 void reset() noexcept { pending_length = 0; }
+
+  /**
+   * Parses the numbers of the block [first, last), storing at most `max`
+   * values in `out`, as `from_chars_many` does. The returned value is that of
+   * `from_chars_many`, but for the number at the end of the block, which is not
+   * parsed yet. If `max` values were stored, `ptr` points to the first
+   * number that was not parsed: feed the rest of the block again from there.
+   *
+   * On error, `ptr` points to the first character of the invalid number, or is
+   * `first` if the number started in a previous block, and the stream cannot
+   * be resumed. A number that is split between blocks and that is longer
+   * than `max_split_length()` is an error (`std::errc::value_too_large`).
+   */
+  FASTFLOAT_CONSTEXPR20 from_chars_many_result_t<UC>
+  feed(UC const *first, UC const *last, T *out, size_t max) noexcept {
+    from_chars_many_result_t<UC> answer;
+    answer.ptr = first;
+    answer.ec = std::errc();
+    answer.count = 0;
+    if (pending_length != 0) {
+      // The block starts with the rest of the pending number.
+      UC const *head_end = first;
+      while (head_end != last && !set.contains(*head_end)) {
+        ++head_end;
+      }
+      size_t const head_length = size_t(head_end - first);
+      if (head_length > max_split_length() - pending_length) {
+        pending_length = 0;
+        answer.ec = std::errc::value_too_large;
+        return answer;
+      }
+      append(first, head_end);
+      if (head_end == last) {
+        answer.ptr = last;
+        return answer;
+      }
+      if (max == 0) {
+        pending_length -= head_length;
+        return answer;
+      }
+      from_chars_many_result_t<UC> const r =
+          from_chars_many(pending, pending + pending_length, out, 1, set,
+                          parse_options);
+      pending_length = 0;
+      if (r.ec != std::errc()) {
+        answer.ec = r.ec;
+        return answer;
+      }
+      answer.count = 1;
+      first = head_end;
+    }
+
+    // The number at the end of the block may continue in the next one.
+    UC const *tail = last;
+    while (tail != first && !set.contains(tail[-1])) {
+      --tail;
+    }
+    from_chars_many_result_t<UC> const r =
+        from_chars_many(first, tail, out + answer.count, max - answer.count,
+                        set, parse_options);
+    answer.ptr = r.ptr;
+    answer.ec = r.ec;
+    answer.count += r.count;
+    if (r.ec != std::errc() || r.ptr != tail) {
+      return answer;
+    }
+    if (size_t(last - tail) > max_split_length()) {
+      answer.ec = std::errc::value_too_large;
+      return answer;
+    }
+    append(tail, last);
+    answer.ptr = last;
+    return answer;
+  }
+
+  /**
+   * Ends the stream: parses the number at the end of the last block, if any,
+   * into `value`. In the returned value, `count` is 1 if a value was stored
+   * and 0 otherwise, and `ptr` is null. The parser is then ready for a new
+   * stream.
+   */
+  FASTFLOAT_CONSTEXPR20 from_chars_many_result_t<UC>
+  finish(T &value) noexcept {
+    from_chars_many_result_t<UC> answer;
+    answer.ptr = nullptr;
+    answer.ec = std::errc();
+    answer.count = 0;
+    if (pending_length != 0) {
+      from_chars_many_result_t<UC> const r =
+          from_chars_many(pending, pending + pending_length, &value, 1, set,
+                          parse_options);
+      answer.ec = r.ec;
+      answer.count = r.count;
+      pending_length = 0;
+    }
+    return answer;
+  }
+
+private:
+  FASTFLOAT_CONSTEXPR14 void append(UC const *first, UC const *last) noexcept {
+    while (first != last) {
+      pending[pending_length++] = *first++;
+    }
+  }
+
+  separator_set set;
+  parse_options_t<UC> parse_options;
+  UC pending[detail::stream_max_split_length];
+  size_t pending_length;
+};
+
+} // namespace fast_float
+
+#endif
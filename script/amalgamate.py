@@ -41,6 +41,13 @@ for filename in [
     "bigint.h",
     "digit_comparison.h",
     "parse_number.h",
+    "parse_context.h",
+    "fixed_point.h",
+    "cpu_dispatch.h",
+    "parse_many.h",
+    "stream_parser.h",
+    "find_number.h",
+    "parse_reduce.h",
 ]:
     with open("include/fast_float/" + filename, encoding="utf8") as f:
         text = ""
@@ -112,6 +119,13 @@ text = "".join(
         processed_files["bigint.h"],
         processed_files["digit_comparison.h"],
         processed_files["parse_number.h"],
+        processed_files["parse_context.h"],
+        processed_files["fixed_point.h"],
+        processed_files["cpu_dispatch.h"],
+        processed_files["parse_many.h"],
+        processed_files["stream_parser.h"],
+        processed_files["find_number.h"],
+        processed_files["parse_reduce.h"],
     ]
 )
 
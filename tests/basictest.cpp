@@ -14,6 +14,7 @@
 #include <string>
 #include <system_error>
 #include <type_traits>
+#include <vector>
 
 #if FASTFLOAT_IS_CONSTEXPR
 #ifndef FASTFLOAT_CONSTEXPR_TESTS
@@ -604,6 +605,50 @@ TEST_CASE("full_multiplication") {
   test_full_multiplication(bit << 63, bit << 63, 0u, bit << 62);
 }
 
+template <typename T> void test_compute_float_batch() {
+  using binary = fast_float::binary_format<T>;
+  std::vector<int64_t> q;
+  std::vector<uint64_t> w;
+  uint64_t const special[] = {0,
+                              1,
+                              5,
+                              (uint64_t(1) << 53) + 1, // halfway for doubles
+                              (uint64_t(1) << 24) + 1, // halfway for floats
+                              9007199254740991,
+                              10000000000000000000u,
+                              0xFFFFFFFFFFFFFFFF};
+  uint64_t state = 0x9E3779B97F4A7C15;
+  for (int64_t e = -400; e <= 400; e++) {
+    for (uint64_t m : special) {
+      q.push_back(e);
+      w.push_back(m);
+    }
+    for (int i = 0; i < 16; i++) {
+      state ^= state << 13;
+      state ^= state >> 7;
+      state ^= state << 17;
+      q.push_back(e);
+      w.push_back(state >> (i * 4));
+    }
+  }
+  std::vector<fast_float::adjusted_mantissa> answers(q.size());
+  size_t const invalid = fast_float::compute_float_batch<binary>(
+      q.data(), w.data(), answers.data(), q.size());
+  CHECK_EQ(invalid, 0u);
+  for (size_t i = 0; i < q.size(); i++) {
+    fast_float::adjusted_mantissa const expected =
+        fast_float::compute_float<binary>(q[i], w[i]);
+    INFO("q=" << q[i] << " w=" << iHexAndDec(w[i]));
+    CHECK_EQ(answers[i].mantissa, expected.mantissa);
+    CHECK_EQ(answers[i].power2, expected.power2);
+  }
+}
+
+TEST_CASE("compute_float_batch") {
+  test_compute_float_batch<double>();
+  test_compute_float_batch<float>();
+}
+
 TEST_CASE("issue8") {
   char const *s =
       "3."
@@ -2452,4 +2497,47 @@ TEST_CASE("integer_times_pow10") {
     all::verify_integer_times_pow10(std::numeric_limits<uint64_t>::max(), 42);
     all::verify_integer_times_pow10(std::numeric_limits<uint64_t>::max(), -42);
   }
-}
\ No newline at end of file
+}
+
+template <typename T> void verify_integer_times_pow10_many() {
+  std::vector<int64_t> mantissas = {0,
+                                    1,
+                                    -1,
+                                    31,
+                                    -4567,
+                                    9007199254740992,  // 2^53
+                                    -9007199254740993, // too large for Clinger
+                                    123456789012345678,
+                                    std::numeric_limits<int64_t>::max(),
+                                    std::numeric_limits<int64_t>::min() + 1};
+  std::vector<T> out(mantissas.size());
+  std::vector<int> exponents(mantissas.size());
+  for (int e = -350; e <= 350; e++) {
+    fast_float::integer_times_pow10_many(mantissas.data(), e, out.data(),
+                                         mantissas.size());
+    for (size_t i = 0; i < mantissas.size(); i++) {
+      INFO("fixed scale: " << mantissas[i] << "e" << e);
+      CHECK_EQ(out[i], fast_float::integer_times_pow10<T>(mantissas[i], e));
+    }
+    for (size_t i = 0; i < mantissas.size(); i++) {
+      exponents[i] = e + int(i) - 5;
+    }
+    fast_float::integer_times_pow10_many(mantissas.data(), exponents.data(),
+                                         out.data(), mantissas.size());
+    for (size_t i = 0; i < mantissas.size(); i++) {
+      INFO(mantissas[i] << "e" << exponents[i]);
+      CHECK_EQ(out[i],
+               fast_float::integer_times_pow10<T>(mantissas[i], exponents[i]));
+    }
+  }
+}
+
+TEST_CASE("integer_times_pow10_many") {
+  verify_integer_times_pow10_many<double>();
+  verify_integer_times_pow10_many<float>();
+  // the rounding mode is checked once per call, it must still be honored
+  fesetround(FE_UPWARD);
+  verify_integer_times_pow10_many<double>();
+  verify_integer_times_pow10_many<float>();
+  fesetround(FE_TONEAREST);
+}
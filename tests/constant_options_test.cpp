@@ -0,0 +1,128 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest/doctest.h"
+
+#include "fast_float/fast_float.h"
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <system_error>
+#include <vector>
+
+using fast_float::chars_format;
+
+// Valid and invalid inputs, in all the formats: the numbers, the signs, the
+// exponents, the decimal points, infinity and NaN, and the white space.
+std::vector<std::string> const inputs = {
+    "0",
+    "1",
+    "-1",
+    "+1",
+    "01",
+    "1.5",
+    "1,5",
+    "-0.25",
+    ".5",
+    "5.",
+    "1e10",
+    "1E-10",
+    "1e",
+    "1e+",
+    "1d5",
+    "1+5",
+    "1-5",
+    "-.5e2",
+    "2.2250738585072013830902327173324040642192159804623318306e-308",
+    "123456789012345678901234567890",
+    "1,234",
+    "inf",
+    "-infinity",
+    "nan",
+    "nan(snan)",
+    " 1",
+    "\t -2.5",
+    "  ",
+    "",
+    "-",
+    "x",
+    "0x1p3",
+    "127",
+    "128",
+    "-129",
+    "ff",
+    "FF",
+    "z",
+    "1010",
+};
+
+template <typename T, chars_format Fmt, char DecimalPoint = '.',
+          int Base = 10>
+void check_same_as_advanced() {
+  fast_float::parse_options const options(Fmt, DecimalPoint, Base);
+  for (std::string const &s : inputs) {
+    INFO("s=" << s);
+    T expected{};
+    auto const e = fast_float::from_chars_advanced(
+        s.data(), s.data() + s.size(), expected, options);
+    T value{};
+    auto const r = fast_float::from_chars<T, Fmt, DecimalPoint, Base>(
+        s.data(), s.data() + s.size(), value);
+    CHECK(r.ec == e.ec);
+    CHECK(r.ptr == e.ptr);
+    // NaN compares by bits
+    CHECK(std::memcmp(&value, &expected, sizeof(T)) == 0);
+  }
+}
+
+TEST_CASE("from_chars<options>.floats") {
+  check_same_as_advanced<double, chars_format::general>();
+  check_same_as_advanced<float, chars_format::general>();
+  check_same_as_advanced<double, chars_format::scientific>();
+  check_same_as_advanced<double, chars_format::fixed>();
+  check_same_as_advanced<double, chars_format::json>();
+  check_same_as_advanced<double, chars_format::json_or_infnan>();
+  check_same_as_advanced<double, chars_format::fortran>();
+  check_same_as_advanced<double, chars_format::general, ','>();
+  check_same_as_advanced<double, chars_format::general |
+                                     chars_format::allow_leading_plus |
+                                     chars_format::skip_white_space>();
+  check_same_as_advanced<double, chars_format::general |
+                                     chars_format::no_infnan>();
+}
+
+TEST_CASE("from_chars<options>.integers") {
+  check_same_as_advanced<int, chars_format::general>();
+  check_same_as_advanced<int8_t, chars_format::general>();
+  check_same_as_advanced<uint64_t, chars_format::general>();
+  check_same_as_advanced<uint32_t, chars_format::general, '.', 16>();
+  check_same_as_advanced<int64_t, chars_format::general, '.', 2>();
+  check_same_as_advanced<int, chars_format::general, '.', 36>();
+  check_same_as_advanced<int, chars_format::general, '.', 1>();
+  check_same_as_advanced<int, chars_format::general |
+                                  chars_format::allow_leading_plus |
+                                  chars_format::skip_white_space>();
+}
+
+TEST_CASE("from_chars<options>.wide") {
+  std::u16string const s = u"-12.5e1";
+  double d;
+  auto r = fast_float::from_chars<double, chars_format::json>(
+      s.data(), s.data() + s.size(), d);
+  CHECK(r.ec == std::errc());
+  CHECK(r.ptr == s.data() + s.size());
+  CHECK(d == -125);
+  r = fast_float::from_chars<double, chars_format::fixed>(
+      s.data(), s.data() + s.size(), d);
+  CHECK(r.ec == std::errc());
+  CHECK(r.ptr == s.data() + 5);
+  CHECK(d == -12.5);
+}
+
+#if FASTFLOAT_IS_CONSTEXPR
+constexpr double parse_json(char const *s, size_t length) {
+  double value = 0;
+  fast_float::from_chars<double, chars_format::json>(s, s + length, value);
+  return value;
+}
+static_assert(parse_json("-1.25", 5) == -1.25, "constexpr parse failed");
+#endif
@@ -0,0 +1,125 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest/doctest.h"
+
+#define FASTFLOAT_RUNTIME_DISPATCH 1
+#include "fast_float/parallel_parse.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+using fast_float::simd_kernel;
+
+// The kernels that the processor supports, from scalar to the detected one.
+std::vector<simd_kernel> supported_kernels() {
+  std::vector<simd_kernel> kernels;
+  for (int k = 0; k <= int(fast_float::detected_simd_kernel()); k++) {
+    kernels.push_back(simd_kernel(k));
+  }
+  return kernels;
+}
+
+TEST_CASE("cpu_dispatch.force") {
+  std::printf("detected kernel: %d\n", int(fast_float::detected_simd_kernel()));
+  simd_kernel const detected = fast_float::detected_simd_kernel();
+  CHECK(fast_float::active_simd_kernel() == detected);
+  for (simd_kernel k : supported_kernels()) {
+    CHECK(fast_float::force_simd_kernel(k));
+    CHECK(fast_float::active_simd_kernel() == k);
+  }
+  if (detected != simd_kernel::avx512) {
+    CHECK(!fast_float::force_simd_kernel(simd_kernel::avx512));
+    CHECK(fast_float::active_simd_kernel() == detected);
+  }
+  CHECK(!fast_float::force_simd_kernel(simd_kernel(-1)));
+  CHECK(fast_float::force_simd_kernel(detected));
+}
+
+// Numbers with runs of digits of all lengths, with and without errors.
+std::string random_input(std::mt19937_64 &rng, size_t count, bool integers) {
+  std::string input;
+  for (size_t i = 0; i < count; i++) {
+    size_t const digits = 1 + rng() % 20;
+    for (size_t j = 0; j < digits; j++) {
+      input.push_back(char('0' + rng() % 10));
+    }
+    if (!integers && rng() % 2) {
+      input.push_back('.');
+      size_t const fraction = rng() % 24;
+      for (size_t j = 0; j < fraction; j++) {
+        input.push_back(char('0' + rng() % 10));
+      }
+      if (rng() % 4 == 0) {
+        input += "e-" + std::to_string(rng() % 40);
+      }
+    }
+    input.push_back((rng() % 5) ? ' ' : '\n');
+  }
+  return input;
+}
+
+template <typename T>
+void check_same_with_all_kernels(std::string const &input, size_t max) {
+  std::vector<T> expected(max);
+  fast_float::force_simd_kernel(simd_kernel::scalar);
+  auto const scalar = fast_float::from_chars_many(
+      input.data(), input.data() + input.size(), expected.data(), max);
+  for (simd_kernel k : supported_kernels()) {
+    CHECK(fast_float::force_simd_kernel(k));
+    std::vector<T> out(max);
+    auto const answer = fast_float::from_chars_many(
+        input.data(), input.data() + input.size(), out.data(), max);
+    CHECK(answer.ec == scalar.ec);
+    CHECK(answer.ptr == scalar.ptr);
+    CHECK(answer.count == scalar.count);
+    for (size_t i = 0; i < answer.count; i++) {
+      CHECK(out[i] == expected[i]);
+    }
+  }
+  fast_float::force_simd_kernel(fast_float::detected_simd_kernel());
+}
+
+TEST_CASE("cpu_dispatch.parse_many") {
+  std::mt19937_64 rng(13);
+  for (int round = 0; round < 20; round++) {
+    std::string const floats = random_input(rng, 2000, false);
+    check_same_with_all_kernels<double>(floats, 2000);
+    check_same_with_all_kernels<float>(floats, 2000);
+    std::string const integers = random_input(rng, 2000, true);
+    // The numbers of more than 19 digits overflow.
+    check_same_with_all_kernels<uint64_t>(integers, 2000);
+    check_same_with_all_kernels<double>(integers, 2000);
+  }
+  check_same_with_all_kernels<double>("1.5 2.25 x 4", 4);
+  check_same_with_all_kernels<int>("12345678901234567 8", 4);
+}
+
+TEST_CASE("cpu_dispatch.separator_masks") {
+  std::mt19937_64 rng(5);
+  std::string input;
+  for (size_t i = 0; i < 64 * 100; i++) {
+    input.push_back(char(' ' + rng() % 95));
+  }
+  for (char const *chars : {" ", " \n\t", ",;", "0123456789", "ab,;: \t\n"}) {
+    fast_float::separator_set const set(chars);
+    fast_float::force_simd_kernel(simd_kernel::scalar);
+    fast_float::detail::separator_classifier<char> const scalar(set);
+    for (simd_kernel k : supported_kernels()) {
+      CHECK(fast_float::force_simd_kernel(k));
+      fast_float::detail::separator_classifier<char> const classifier(set);
+      for (size_t i = 0; i + 64 <= input.size(); i += 64) {
+        CHECK(classifier.classify(input.data() + i, 64) ==
+              scalar.classify(input.data() + i, 64));
+      }
+      CHECK(fast_float::detail::count_tokens(input.data(),
+                                             input.data() + input.size(),
+                                             classifier) ==
+            fast_float::detail::count_tokens(input.data(),
+                                             input.data() + input.size(),
+                                             scalar));
+    }
+  }
+  fast_float::force_simd_kernel(fast_float::detected_simd_kernel());
+}
@@ -0,0 +1,264 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest/doctest.h"
+
+#include "fast_float/fast_float.h"
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <string>
+#include <system_error>
+
+using fast_float::chars_format;
+
+fast_float::parse_options separated(char separator, int group_size = 0,
+                                    int base = 10) {
+  return fast_float::parse_options(chars_format::general, '.', base, separator,
+                                   group_size);
+}
+
+// Inserts the separator between the groups of `group` digits of the integer
+// part, counted from the decimal point, and of the fraction, counted from it.
+std::string group_digits(std::string const &s, size_t group, char separator) {
+  size_t const start = (s[0] == '-') ? 1 : 0;
+  size_t dot = s.find('.');
+  size_t const end = s.find_first_of("eE");
+  size_t const digits_end = (end == std::string::npos) ? s.size() : end;
+  if (dot == std::string::npos) {
+    dot = digits_end;
+  }
+  std::string out;
+  for (size_t i = 0; i < s.size(); i++) {
+    if ((i > start && i < dot && (dot - i) % group == 0) ||
+        (i > dot + 1 && i < digits_end && (i - dot - 1) % group == 0)) {
+      out.push_back(separator);
+    }
+    out.push_back(s[i]);
+  }
+  return out;
+}
+
+// With separators, the numbers have the value of the same numbers without
+// them, including those with many digits, which need digit_comp.
+template <typename T> void check_random_floats() {
+  std::mt19937_64 rng(sizeof(T));
+  for (int i = 0; i < 100000; i++) {
+    std::string s = (rng() % 4 == 0) ? "-" : "";
+    size_t const integer_digits = size_t(rng() % 30);
+    size_t const fraction_digits = size_t(rng() % 30);
+    for (size_t j = 0; j < integer_digits; j++) {
+      s.push_back(char('0' + rng() % 10));
+    }
+    if (integer_digits == 0 || fraction_digits != 0) {
+      s.push_back('.');
+      for (size_t j = 0; j <= fraction_digits; j++) {
+        s.push_back(char('0' + rng() % 10));
+      }
+    }
+    if (rng() % 4 == 0) {
+      s += "e" + std::to_string(int(rng() % 80) - 40);
+    }
+    // A halfway case between two doubles, for digit_comp.
+    if (i % 16 == 0) {
+      s = (rng() % 2 ? "9007199254740993" : "9007199254740993.000000000000001");
+    }
+    size_t const group = 1 + size_t(rng() % 5);
+    std::string const grouped = group_digits(s, group, '_');
+    T expected = 0;
+    T value = 0;
+    auto const r0 = fast_float::from_chars(s.data(), s.data() + s.size(),
+                                           expected);
+    auto const r = fast_float::from_chars_advanced(
+        grouped.data(), grouped.data() + grouped.size(), value,
+        separated('_', int(group)));
+    INFO("grouped=" << grouped);
+    CHECK(r.ec == r0.ec);
+    CHECK(std::memcmp(&value, &expected, sizeof(T)) == 0);
+    CHECK(r.ptr == grouped.data() + grouped.size());
+  }
+}
+
+TEST_CASE("digit_separator.random_floats") {
+  check_random_floats<double>();
+  check_random_floats<float>();
+}
+
+void check_parses_as(std::string const &s, fast_float::parse_options options,
+                     std::errc ec, double expected, size_t end) {
+  INFO("s=" << s);
+  double value = 0;
+  auto const r =
+      fast_float::from_chars_advanced(s.data(), s.data() + s.size(), value,
+                                      options);
+  CHECK(r.ec == ec);
+  CHECK(r.ptr == s.data() + end);
+  if (ec == std::errc()) {
+    CHECK(value == expected);
+  }
+}
+
+TEST_CASE("digit_separator.floats") {
+  auto const ok = std::errc();
+  auto const invalid = std::errc::invalid_argument;
+  check_parses_as("1,234,567.89", separated(','), ok, 1234567.89, 12);
+  check_parses_as("1,234,567.89", separated(',', 3), ok, 1234567.89, 12);
+  check_parses_as("-1_0.2_5e1_0", separated('_'), ok, -102.5, 10);
+  check_parses_as("0.000_001", separated('_', 3), ok, 0.000001, 9);
+  check_parses_as("1 234,5", fast_float::parse_options(chars_format::general,
+                                                       ',', 10, ' '),
+                  ok, 1234.5, 7);
+  // A separator that is not between two digits ends the number.
+  check_parses_as("1,", separated(','), ok, 1, 1);
+  check_parses_as("1,,2", separated(','), ok, 1, 1);
+  check_parses_as("1,.5", separated(','), ok, 1, 1);
+  check_parses_as("1.,5", separated(','), ok, 1, 2);
+  check_parses_as(",1", separated(','), invalid, 0, 0);
+  check_parses_as("-,1", separated(','), invalid, 0, 0);
+  // Without the option, the separator is not a digit.
+  check_parses_as("1,234", fast_float::parse_options(), ok, 1, 1);
+  // The groups of the integer part, then those of the fraction.
+  check_parses_as("12,34", separated(',', 3), invalid, 0, 0);
+  check_parses_as("1,2345", separated(',', 3), invalid, 0, 0);
+  check_parses_as("1234,567", separated(',', 3), invalid, 0, 0);
+  check_parses_as("1234.5", separated(',', 3), ok, 1234.5, 6);
+  check_parses_as("1.234,56", separated(',', 3), ok, 1.23456, 8);
+  check_parses_as("1.23,456", separated(',', 3), invalid, 0, 0);
+  check_parses_as("1.2345", separated(',', 3), ok, 1.2345, 6);
+  check_parses_as("1,234.2345,6", separated(',', 3), invalid, 0, 0);
+  // Many digits.
+  check_parses_as("123,456,789,012,345,678,901,234,567,890e-10",
+                  separated(',', 3), ok, 12345678901234567890.0, 43);
+  check_parses_as("0.000,000,000,000,000,000,012,345,678,901,234,567,89",
+                  separated(',', 3), ok, 1.234567890123456789e-20, 52);
+  check_parses_as("9,007,199,254,740,993", separated(','), ok,
+                  9007199254740992.0, 21);
+  check_parses_as("9,007,199,254,740,993.000,000,000,000,000,1",
+                  separated(','), ok, 9007199254740994.0, 43);
+  // JSON has no separators, but they may be enabled too.
+  check_parses_as("-1,234.5", fast_float::parse_options(chars_format::json,
+                                                        '.', 10, ','),
+                  ok, -1234.5, 8);
+  check_parses_as("0,123", fast_float::parse_options(chars_format::json, '.',
+                                                     10, ','),
+                  invalid, 0, 0);
+}
+
+template <typename T>
+void check_int_parses_as(std::string const &s,
+                         fast_float::parse_options options, std::errc ec,
+                         T expected, size_t end) {
+  INFO("s=" << s);
+  T value = 0;
+  auto const r =
+      fast_float::from_chars_advanced(s.data(), s.data() + s.size(), value,
+                                      options);
+  CHECK(r.ec == ec);
+  CHECK(r.ptr == s.data() + end);
+  if (ec == std::errc()) {
+    CHECK(value == expected);
+  }
+}
+
+TEST_CASE("digit_separator.integers") {
+  auto const ok = std::errc();
+  auto const invalid = std::errc::invalid_argument;
+  auto const out = std::errc::result_out_of_range;
+  check_int_parses_as<int64_t>("1_000_000", separated('_', 3), ok, 1000000, 9);
+  check_int_parses_as<int64_t>("-9_223_372_036_854_775_808", separated('_', 3),
+                               ok, std::numeric_limits<int64_t>::min(), 26);
+  check_int_parses_as<int64_t>("9_223_372_036_854_775_808", separated('_'),
+                               out, 0, 25);
+  check_int_parses_as<uint64_t>("18_446_744_073_709_551_615",
+                                separated('_', 3), ok,
+                                std::numeric_limits<uint64_t>::max(), 26);
+  check_int_parses_as<uint64_t>("18_446_744_073_709_551_616",
+                                separated('_', 3), out, 0, 26);
+  check_int_parses_as<uint64_t>("184_467_440_737_095_516_150",
+                                separated('_', 3), out, 0, 27);
+  check_int_parses_as<uint8_t>("2_55", separated('_'), ok, 255, 4);
+  check_int_parses_as<uint8_t>("2_56", separated('_'), out, 0, 4);
+  check_int_parses_as<int32_t>("ff_ff", separated('_', 2, 16), ok, 65535, 5);
+  check_int_parses_as<int32_t>("1010_1010", separated('_', 4, 2), ok, 170, 9);
+  check_int_parses_as<int32_t>("7_7_7", separated('_', 0, 8), ok, 511, 5);
+  check_int_parses_as<int32_t>("1_0000", separated('_', 3), invalid, 0, 0);
+  check_int_parses_as<int32_t>("_1", separated('_'), invalid, 0, 0);
+  check_int_parses_as<int32_t>("1__2", separated('_'), ok, 1, 1);
+  check_int_parses_as<int32_t>("12_", separated('_'), ok, 12, 2);
+  check_int_parses_as<int32_t>("0_0_0_1", separated('_'), ok, 1, 7);
+  check_int_parses_as<int32_t>("123_4.5", separated('_'), ok, 1234, 5);
+#ifdef FASTFLOAT_HAS_INT128
+  check_int_parses_as<__int128_t>(
+      "-170_141_183_460_469_231_731_687_303_715_884_105_728",
+      separated('_', 3), ok, std::numeric_limits<__int128_t>::min(), 52);
+  check_int_parses_as<__uint128_t>(
+      "340_282_366_920_938_463_463_374_607_431_768_211_456",
+      separated('_', 3), out, 0, 51);
+#endif
+  // Random integers, against the same without separators.
+  std::mt19937_64 rng(42);
+  for (int i = 0; i < 100000; i++) {
+    std::string const s = std::to_string(int64_t(rng()) >> (rng() % 64));
+    size_t const group = 1 + size_t(rng() % 4);
+    std::string const grouped = group_digits(s, group, '\'');
+    int64_t expected = 0;
+    fast_float::from_chars(s.data(), s.data() + s.size(), expected);
+    check_int_parses_as<int64_t>(grouped, separated('\'', int(group)), ok,
+                                 expected, grouped.size());
+  }
+}
+
+template <typename UC> void check_wide() {
+  std::string const narrow = "-1 234 567.890 1";
+  std::basic_string<UC> const s(narrow.begin(), narrow.end());
+  fast_float::parse_options_t<UC> const options(chars_format::general, UC('.'),
+                                                10, UC(' '), 3);
+  double d = 0;
+  auto r = fast_float::from_chars_advanced(s.data(), s.data() + s.size(), d,
+                                           options);
+  CHECK(r.ec == std::errc());
+  CHECK(r.ptr == s.data() + s.size());
+  CHECK(d == -1234567.8901);
+  int64_t i = 0;
+  r = fast_float::from_chars_advanced(s.data(), s.data() + s.size(), i,
+                                      options);
+  CHECK(r.ec == std::errc());
+  CHECK(r.ptr == s.data() + 10);
+  CHECK(i == -1234567);
+}
+
+TEST_CASE("digit_separator.wide") {
+  check_wide<char16_t>();
+  check_wide<char32_t>();
+  check_wide<wchar_t>();
+}
+
+TEST_CASE("digit_separator.fixed_point") {
+  std::string s = "1,234,567.891,234,567,890,123";
+  int64_t value = 0;
+  auto r = fast_float::from_chars_fixed_point<int64_t, 4>(
+      s.data(), s.data() + s.size(), value,
+      fast_float::fixed_point_rounding::nearest_even, separated(',', 3));
+  CHECK(r.ec == std::errc());
+  CHECK(r.ptr == s.data() + s.size());
+  CHECK(value == 12345678912);
+  s = "12,345.67";
+  r = fast_float::from_chars_fixed_point<int64_t, 2>(
+      s.data(), s.data() + s.size(), value,
+      fast_float::fixed_point_rounding::reject, separated(','));
+  CHECK(r.ec == std::errc());
+  CHECK(value == 1234567);
+}
+
+TEST_CASE("digit_separator.many") {
+  std::string const s = "1,234.5 -6,789 10,000,000.25";
+  double out[3];
+  auto const r = fast_float::from_chars_many(
+      s.data(), s.data() + s.size(), out, 3,
+      fast_float::separator_set::white_space(), separated(',', 3));
+  CHECK(r.ec == std::errc());
+  CHECK(r.count == 3);
+  CHECK(out[0] == 1234.5);
+  CHECK(out[1] == -6789);
+  CHECK(out[2] == 10000000.25);
+}
@@ -13,8 +13,12 @@
 
 #if FASTFLOAT_CPLUSPLUS >= 201703L
 
+#include <cerrno>
 #include <cstdlib>
 #include <iostream>
+#include <limits>
+#include <random>
+#include <string>
 #include <vector>
 #include <string_view>
 #include <cstring>
@@ -44,6 +48,51 @@ from base (Note: only 64 bit int and unsigned are tested) leading zeros tests -
 ignores all zeroes in front of valid number after converted from base
 */
 
+#ifdef FASTFLOAT_HAS_INT128
+// Parses a 128-bit integer digit by digit, with the overflow checked on each
+// digit, and sets `length` to the length of the number.
+template <typename T>
+std::errc parse_int128_reference(std::string const &s, int base, T &value,
+                                 size_t &length) {
+  size_t k = 0;
+  bool const negative = !s.empty() && s[0] == '-';
+  if (negative) {
+    if (!std::numeric_limits<T>::is_signed) {
+      return std::errc::invalid_argument;
+    }
+    k++;
+  }
+  size_t const start = k;
+  __uint128_t i = 0;
+  bool overflow = false;
+  for (; k < s.size(); k++) {
+    char const c = s[k];
+    int const digit = (c >= '0' && c <= '9')   ? c - '0'
+                      : (c >= 'a' && c <= 'z') ? c - 'a' + 10
+                      : (c >= 'A' && c <= 'Z') ? c - 'A' + 10
+                                               : 99;
+    if (digit >= base) {
+      break;
+    }
+    if (i > (~__uint128_t(0) - unsigned(digit)) / unsigned(base)) {
+      overflow = true;
+    } else {
+      i = i * unsigned(base) + unsigned(digit);
+    }
+  }
+  if (k == start) {
+    return std::errc::invalid_argument;
+  }
+  length = k;
+  if (overflow ||
+      i > __uint128_t(std::numeric_limits<T>::max()) + __uint128_t(negative)) {
+    return std::errc::result_out_of_range;
+  }
+  value = negative ? T(0 - i) : T(i);
+  return std::errc();
+}
+#endif
+
 int main() {
   // int basic test
   std::vector<int> const int_basic_test_expected{0, 10, -40, 1001, 9};
@@ -1348,11 +1397,212 @@ int main() {
       return EXIT_FAILURE;
     }
   }
+  // Bases 2, 8 and 16 are parsed eight digits at a time, or sixteen with
+  // SIMD. Runs of all lengths around the 64-bit limit, after leading zeros and
+  // before a character that is not a digit, must give the results of
+  // strtoull, as in the other bases.
+  {
+    std::mt19937_64 rng(2024);
+    char const digits[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+    char const tails[] = "g.:/@G`";
+    bool failed = false;
+    for (int base : {2, 3, 8, 10, 16, 36}) {
+      std::string const alphabet = (base == 16)
+                                       ? "0123456789abcdefABCDEF"
+                                       : std::string(digits, size_t(base));
+      for (int trial = 0; trial < 20000 && !failed; trial++) {
+        std::string s(size_t(rng() % 4), '0');
+        size_t const length = size_t(rng() % 70);
+        for (size_t j = 0; j < length; j++) {
+          s.push_back(alphabet[rng() % alphabet.size()]);
+        }
+        if (rng() % 2 == 0) {
+          s.push_back(tails[rng() % (sizeof(tails) - 1)]);
+        }
+        errno = 0;
+        char *end;
+        unsigned long long const expected =
+            std::strtoull(s.c_str(), &end, base);
+        std::errc const expected_ec =
+            (end == s.c_str()) ? std::errc::invalid_argument
+            : (errno == ERANGE) ? std::errc::result_out_of_range
+                                : std::errc();
+        uint64_t result = 0;
+        auto answer = fast_float::from_chars(s.data(), s.data() + s.size(),
+                                             result, base);
+        if (answer.ec != expected_ec ||
+            (expected_ec != std::errc::invalid_argument &&
+             answer.ptr != s.data() + (end - s.c_str())) ||
+            (expected_ec == std::errc() && result != expected)) {
+          failed = true;
+          std::cerr << "could not parse " << s << " in base " << base
+                    << std::endl;
+        }
+      }
+    }
+    // At the maximal number of digits, the value can wrap around to more than
+    // the smallest value of that length.
+    for (std::string_view const s :
+         {"30000000000000000000", "99999999999999999999",
+          "3777777777777777777777", "5000000000000000000000"}) {
+      uint64_t result = 0;
+      int const base = s.size() == 20 ? 10 : 8;
+      auto answer =
+          fast_float::from_chars(s.data(), s.data() + s.size(), result, base);
+      if (answer.ec != std::errc::result_out_of_range) {
+        failed = true;
+        std::cerr << "overflow not detected for " << s << std::endl;
+      }
+    }
+    // A wide code unit whose low byte is a digit ends the run.
+    std::u16string const hex = u"123456789abcdefABCDEF0123";
+    for (size_t k = 0; k < hex.size(); k++) {
+      std::u16string s = hex;
+      s[k] = char16_t(0x100 + s[k]);
+      uint64_t result = 0;
+      auto answer =
+          fast_float::from_chars(s.data(), s.data() + s.size(), result, 16);
+      if (answer.ptr != s.data() + k) {
+        failed = true;
+        std::cerr << "wide code unit not rejected at " << k << std::endl;
+      }
+    }
+    if (failed) {
+      return EXIT_FAILURE;
+    }
+  }
+  // The 32- and 64-bit integers are parsed in base 10 from a mask of the
+  // digits among eight characters. Numbers of all lengths around the limits of
+  // each type, after leading zeros, and before another character or the end of
+  // the input, must give the results of strtoll and strtoull.
+  {
+    std::mt19937_64 rng(2025);
+    bool failed = false;
+    auto check = [&](auto zero) {
+      using T = decltype(zero);
+      for (int trial = 0; trial < 50000 && !failed; trial++) {
+        std::string s;
+        if (std::is_signed<T>::value && rng() % 2 == 0) {
+          s.push_back('-');
+        }
+        s.append(size_t(rng() % 3 == 0 ? rng() % 10 : 0), '0');
+        size_t const length = size_t(rng() % 24);
+        for (size_t j = 0; j < length; j++) {
+          s.push_back(char('0' + rng() % 10));
+        }
+        if (rng() % 2 == 0) {
+          s.push_back(",:/x"[rng() % 4]);
+        }
+        // The input ends where the number does, for the sanitizers.
+        std::vector<char> const input(s.begin(), s.end());
+        errno = 0;
+        char *end;
+        T expected = 0;
+        bool in_range;
+        if (std::is_signed<T>::value) {
+          long long const v = std::strtoll(s.c_str(), &end, 10);
+          in_range = errno != ERANGE &&
+                     v >= (long long)(std::numeric_limits<T>::min()) &&
+                     v <= (long long)(std::numeric_limits<T>::max());
+          expected = T(v);
+        } else {
+          unsigned long long const v = std::strtoull(s.c_str(), &end, 10);
+          in_range = errno != ERANGE &&
+                     v <= (unsigned long long)(std::numeric_limits<T>::max());
+          expected = T(v);
+        }
+        std::errc const expected_ec =
+            (end == s.c_str()) ? std::errc::invalid_argument
+            : in_range         ? std::errc()
+                               : std::errc::result_out_of_range;
+        T result = 0;
+        auto answer = fast_float::from_chars(
+            input.data(), input.data() + input.size(), result);
+        if (answer.ec != expected_ec ||
+            (expected_ec != std::errc::invalid_argument &&
+             answer.ptr != input.data() + (end - s.c_str())) ||
+            (expected_ec == std::errc() && result != expected)) {
+          failed = true;
+          std::cerr << "could not parse " << s << " as a " << sizeof(T) * 8
+                    << "-bit integer" << std::endl;
+        }
+      }
+    };
+    check(int32_t());
+    check(uint32_t());
+    check(int64_t());
+    check(uint64_t());
+    if (failed) {
+      return EXIT_FAILURE;
+    }
+  }
+#ifdef FASTFLOAT_HAS_INT128
+  // The 128-bit integers are parsed in chunks of 64 bits. Numbers of all
+  // lengths around the limits, in several bases, must give the results of a
+  // digit-by-digit parse.
+  {
+    std::mt19937_64 rng(128);
+    bool failed = false;
+    char const digits[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+    auto check = [&](auto zero) {
+      using T = decltype(zero);
+      for (int base : {2, 3, 8, 10, 16, 36}) {
+        for (int trial = 0; trial < 20000 && !failed; trial++) {
+          std::string s;
+          if (rng() % 3 == 0) {
+            s.push_back('-');
+          }
+          s.append(size_t(rng() % 4 == 0 ? rng() % 5 : 0), '0');
+          size_t const length = size_t(rng() % (base == 10 ? 45 : 135));
+          for (size_t j = 0; j < length; j++) {
+            s.push_back(digits[rng() % size_t(base)]);
+          }
+          if (rng() % 2 == 0) {
+            s.push_back(",:/@z"[rng() % 5]);
+          }
+          // The input ends where the number does, for the sanitizers.
+          std::vector<char> const input(s.begin(), s.end());
+          T expected = 0;
+          size_t expected_length = 0;
+          std::errc const expected_ec =
+              parse_int128_reference(s, base, expected, expected_length);
+          T result = 0;
+          auto answer = fast_float::from_chars(
+              input.data(), input.data() + input.size(), result, base);
+          if (answer.ec != expected_ec ||
+              (expected_ec != std::errc::invalid_argument &&
+               answer.ptr != input.data() + expected_length) ||
+              (expected_ec == std::errc() && result != expected)) {
+            failed = true;
+            std::cerr << "could not parse " << s << " in base " << base
+                      << " as a 128-bit integer" << std::endl;
+          }
+        }
+      }
+    };
+    check(__int128_t());
+    check(__uint128_t());
+    // Wide characters and the limits.
+    std::u16string const s = u"-170141183460469231731687303715884105728";
+    __int128_t result = 0;
+    auto answer =
+        fast_float::from_chars(s.data(), s.data() + s.size(), result);
+    if (answer.ec != std::errc() || answer.ptr != s.data() + s.size() ||
+        result != -__int128_t(~__uint128_t(0) >> 1) - 1) {
+      failed = true;
+      std::cerr << "could not parse the smallest 128-bit integer" << std::endl;
+    }
+    if (failed) {
+      return EXIT_FAILURE;
+    }
+  }
+#endif
 
   return EXIT_SUCCESS;
 }
 #else
 #include <iostream>
+#include <limits>
 #include <cstdlib>
 
 int main() {
@@ -0,0 +1,227 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest/doctest.h"
+
+#include "fast_float/fast_float.h"
+
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+#include <system_error>
+#include <vector>
+
+using fast_float::chars_format;
+
+template <typename T, typename UC = char>
+std::vector<T>
+all_numbers(std::basic_string<UC> const &s,
+            fast_float::parse_options_t<UC> options =
+                fast_float::parse_options_t<UC>()) {
+  std::vector<T> out;
+  for (T x : fast_float::find_numbers<T>(s.data(), s.data() + s.size(),
+                                         options)) {
+    out.push_back(x);
+  }
+  return out;
+}
+
+std::string const log_line =
+    "latency=12.5ms status=200 bytes=1.2e6 -3 x-.5 .25 v1.2.3 + - . 1e999 end";
+
+TEST_CASE("find_numbers.floats") {
+  CHECK((all_numbers<double>(log_line) ==
+         std::vector<double>{12.5, 200, 1.2e6, -3, -0.5, 0.25, 1.2, 0.3}));
+  CHECK((all_numbers<float>(log_line) ==
+         std::vector<float>{12.5f, 200, 1.2e6f, -3, -0.5f, 0.25f, 1.2f, 0.3f}));
+  CHECK(all_numbers<double>(std::string()).empty());
+  CHECK(all_numbers<double>(std::string("no numbers, - + . e")).empty());
+  CHECK((all_numbers<double>(std::string("-")) == std::vector<double>{}));
+  CHECK((all_numbers<double>(std::string("x-7")) == std::vector<double>{-7}));
+  CHECK((all_numbers<double>(std::string("--7")) == std::vector<double>{-7}));
+  CHECK((all_numbers<double>(std::string("7-8")) ==
+         std::vector<double>{7, -8}));
+  CHECK((all_numbers<double>(std::string("1e")) == std::vector<double>{1}));
+}
+
+TEST_CASE("find_numbers.integers") {
+  CHECK((all_numbers<int>(log_line) ==
+         std::vector<int>{12, 5, 200, 1, 2, 6, -3, 5, 25, 1, 2, 3, 1, 999}));
+  CHECK((all_numbers<unsigned>(log_line) ==
+         std::vector<unsigned>{12, 5, 200, 1, 2, 6, 3, 5, 25, 1, 2, 3, 1,
+                               999}));
+  // Out of range numbers are skipped.
+  CHECK((all_numbers<uint8_t>(std::string("a=100 b=300 c=7")) ==
+         std::vector<uint8_t>{100, 7}));
+  CHECK((all_numbers<int64_t>(std::string("id:-9223372036854775808;")) ==
+         std::vector<int64_t>{std::numeric_limits<int64_t>::min()}));
+}
+
+TEST_CASE("find_numbers.find_and_parse_next") {
+  char const *first = log_line.data();
+  char const *last = first + log_line.size();
+  double d;
+  auto r = fast_float::find_and_parse_next(first, last, d);
+  CHECK(r);
+  CHECK(r.start == first + 8);
+  CHECK(r.ptr == first + 12);
+  CHECK(d == 12.5);
+  int i;
+  r = fast_float::find_and_parse_next(first, last, i);
+  CHECK(r.start == first + 8);
+  CHECK(r.ptr == first + 10);
+  CHECK(i == 12);
+  // 1e999 is reported.
+  char const *big = first + log_line.find("1e999");
+  r = fast_float::find_and_parse_next(first + log_line.find(" . "), last, d);
+  CHECK(r.ec == std::errc::result_out_of_range);
+  CHECK(r.start == big);
+  CHECK(r.ptr == big + 5);
+  // Nothing left.
+  r = fast_float::find_and_parse_next(big + 5, last, d);
+  CHECK(!r);
+  CHECK(r.ec == std::errc::invalid_argument);
+  CHECK(r.start == last);
+  CHECK(r.ptr == last);
+  r = fast_float::find_and_parse_next(last, last, d);
+  CHECK(r.ec == std::errc::invalid_argument);
+  CHECK(r.start == last);
+}
+
+TEST_CASE("find_numbers.iterator") {
+  std::string const s = "a1b22c333";
+  fast_float::number_iterator<int> it(s.data(), s.data() + s.size());
+  fast_float::number_iterator<int> const end;
+  CHECK(it != end);
+  CHECK(*it == 1);
+  CHECK(it.position().start == s.data() + 1);
+  CHECK(it.position().ptr == s.data() + 2);
+  auto before = it++;
+  CHECK(*before == 1);
+  CHECK(*it == 22);
+  ++it;
+  CHECK(*it == 333);
+  CHECK(it.position().ptr == s.data() + s.size());
+  ++it;
+  CHECK(it == end);
+}
+
+TEST_CASE("find_numbers.options") {
+  // Plus signs.
+  std::string const s = "a+1 b-2";
+  CHECK((all_numbers<double>(s) == std::vector<double>{1, -2}));
+  fast_float::parse_options const plus(chars_format::general |
+                                       chars_format::allow_leading_plus);
+  CHECK((all_numbers<double>(s, plus) == std::vector<double>{1, -2}));
+  double d;
+  auto r = fast_float::find_and_parse_next(s.data(), s.data() + s.size(), d,
+                                           plus);
+  CHECK(r.start == s.data() + 1);
+  r = fast_float::find_and_parse_next(s.data(), s.data() + s.size(), d);
+  CHECK(r.start == s.data() + 2);
+  // Decimal comma.
+  std::string const fr = "prix: 12,5 EUR, 3,25 EUR";
+  fast_float::parse_options const comma(chars_format::general, ',');
+  CHECK((all_numbers<double>(fr, comma) == std::vector<double>{12.5, 3.25}));
+  CHECK((all_numbers<double>(fr) == std::vector<double>{12, 5, 3, 25}));
+  // JSON: a number with a leading zero or without digits before the dot is
+  // skipped whole.
+  std::string const json = "{\"a\":[01,.5,-2.5e1]}";
+  fast_float::parse_options const js(chars_format::json);
+  CHECK((all_numbers<double>(json, js) == std::vector<double>{-25}));
+}
+
+template <typename UC> void check_wide() {
+  std::basic_string<UC> s;
+  for (char c : log_line) {
+    s.push_back(UC(c));
+  }
+  CHECK((all_numbers<double, UC>(s) ==
+         std::vector<double>{12.5, 200, 1.2e6, -3, -0.5, 0.25, 1.2, 0.3}));
+  CHECK((all_numbers<int, UC>(s) ==
+         std::vector<int>{12, 5, 200, 1, 2, 6, -3, 5, 25, 1, 2, 3, 1, 999}));
+}
+
+TEST_CASE("find_numbers.wide") {
+  check_wide<char16_t>();
+  check_wide<char32_t>();
+  check_wide<wchar_t>();
+}
+
+// The numbers as found one character at a time.
+template <typename T>
+std::vector<std::pair<size_t, T>> reference_numbers(std::string const &s) {
+  std::vector<std::pair<size_t, T>> out;
+  bool const is_float = !std::numeric_limits<T>::is_integer;
+  bool const is_signed = std::numeric_limits<T>::is_signed;
+  char const *first = s.data();
+  char const *last = first + s.size();
+  auto digit = [&](size_t i) {
+    return (i < s.size()) && (s[i] >= '0') && (s[i] <= '9');
+  };
+  size_t i = 0;
+  while (i < s.size()) {
+    bool const starts =
+        digit(i) || (is_float && (s[i] == '.') && digit(i + 1)) ||
+        (is_signed && (s[i] == '-') &&
+         (digit(i + 1) || (is_float && (i + 1 < s.size()) &&
+                           (s[i + 1] == '.') && digit(i + 2))));
+    if (!starts) {
+      ++i;
+      continue;
+    }
+    T value;
+    auto r = fast_float::from_chars(first + i, last, value);
+    if (r.ec == std::errc::invalid_argument) {
+      ++i;
+      while (digit(i)) {
+        ++i;
+      }
+      continue;
+    }
+    if (r.ec == std::errc()) {
+      out.emplace_back(i, value);
+    }
+    i = size_t(r.ptr - first);
+  }
+  return out;
+}
+
+template <typename T> void check_random() {
+  std::mt19937 rng(42);
+  char const alphabet[] = "0123456789-.+eE abcxyz\n";
+  for (size_t n = 0; n < 2000; n++) {
+    // Long enough buffers that most of the text is scanned with SIMD.
+    std::string s(rng() % 300, ' ');
+    size_t const density = 1 + rng() % 40;
+    for (char &c : s) {
+      c = (rng() % density == 0) ? alphabet[rng() % (sizeof(alphabet) - 1)]
+                                 : char('a' + rng() % 26);
+    }
+    std::vector<std::pair<size_t, T>> found;
+    fast_float::number_iterator<T> it(s.data(), s.data() + s.size());
+    for (; it != fast_float::number_iterator<T>(); ++it) {
+      found.emplace_back(size_t(it.position().start - s.data()), *it);
+    }
+    INFO("s=" << s);
+    CHECK((found == reference_numbers<T>(s)));
+  }
+}
+
+TEST_CASE("find_numbers.random") {
+  check_random<double>();
+  check_random<float>();
+  check_random<int>();
+  check_random<unsigned>();
+  check_random<int8_t>();
+}
+
+#if FASTFLOAT_IS_CONSTEXPR
+constexpr double constexpr_sum(char const *s, size_t n) {
+  double sum = 0;
+  for (double x : fast_float::find_numbers<double>(s, s + n)) {
+    sum += x;
+  }
+  return sum;
+}
+static_assert(constexpr_sum("a1.5b-2c10", 10) == 9.5, "constexpr");
+#endif
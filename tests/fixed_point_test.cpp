@@ -0,0 +1,258 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest/doctest.h"
+
+#include "fast_float/fast_float.h"
+
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <random>
+#include <string>
+#include <system_error>
+
+using fast_float::chars_format;
+using fast_float::fixed_point_rounding;
+
+fixed_point_rounding const all_roundings[] = {
+    fixed_point_rounding::reject, fixed_point_rounding::toward_zero,
+    fixed_point_rounding::nearest_even, fixed_point_rounding::nearest_away};
+
+// The expected result for the number `digits` * 10^exponent, with the sign,
+// computed on strings: false if it is out of range (or rejected).
+template <typename T>
+bool reference(std::string const &digits, int exponent, bool negative,
+               fixed_point_rounding rounding, T &value) {
+  std::string integral;
+  std::string fraction;
+  int const length = int(digits.size());
+  if (exponent >= 0) {
+    integral = digits + std::string(size_t(exponent), '0');
+  } else if (-exponent >= length) {
+    fraction = std::string(size_t(-exponent - length), '0') + digits;
+  } else {
+    integral = digits.substr(0, size_t(length + exponent));
+    fraction = digits.substr(size_t(length + exponent));
+  }
+  integral.erase(0, integral.find_first_not_of('0'));
+  if (integral.size() > 20) {
+    return false;
+  }
+  errno = 0;
+  uint64_t q =
+      integral.empty() ? 0 : std::strtoull(integral.c_str(), nullptr, 10);
+  if (errno == ERANGE) {
+    return false;
+  }
+  bool const inexact = fraction.find_first_not_of('0') != std::string::npos;
+  if (inexact) {
+    char const first = fraction[0];
+    bool const sticky =
+        fraction.find_first_not_of('0', 1) != std::string::npos;
+    bool up = false;
+    switch (rounding) {
+    case fixed_point_rounding::reject:
+      return false;
+    case fixed_point_rounding::toward_zero:
+      break;
+    case fixed_point_rounding::nearest_even:
+      up = first > '5' || (first == '5' && (sticky || q % 2 == 1));
+      break;
+    case fixed_point_rounding::nearest_away:
+      up = first >= '5';
+      break;
+    }
+    if (up) {
+      if (q == std::numeric_limits<uint64_t>::max()) {
+        return false;
+      }
+      q++;
+    }
+  }
+  uint64_t const max = uint64_t(std::numeric_limits<T>::max());
+  if (q > max + (negative ? 1 : 0)) {
+    return false;
+  }
+  value = (negative && q != 0) ? T(-T(q - 1) - 1) : T(q);
+  return true;
+}
+
+// Random numbers, with up to 30 digits (mostly zeros, to make ties), a decimal
+// point and an exponent, against the reference.
+template <typename T, int Scale> void check_random() {
+  std::mt19937_64 rng(Scale + 100 * int(sizeof(T)));
+  for (int i = 0; i < 100000; i++) {
+    size_t const length = 1 + size_t(rng() % 30);
+    std::string digits;
+    for (size_t j = 0; j < length; j++) {
+      digits.push_back(rng() % 3 == 0 ? char('0' + rng() % 10)
+                                      : (rng() % 2 ? '0' : '5'));
+    }
+    bool const negative = std::numeric_limits<T>::is_signed && rng() % 2 == 0;
+    size_t const point = size_t(rng() % (length + 1));
+    int const exp_number = rng() % 2 ? 0 : int(rng() % 41) - 20;
+    std::string s = negative ? "-" : "";
+    s += digits.substr(0, point);
+    if (point < length || rng() % 2) {
+      s += "." + digits.substr(point);
+    }
+    if (exp_number != 0) {
+      s += "e" + std::to_string(exp_number);
+    }
+    int const exponent = exp_number - int(length - point) + Scale;
+    for (fixed_point_rounding rounding : all_roundings) {
+      T expected = 0;
+      bool const valid =
+          reference<T>(digits, exponent, negative, rounding, expected);
+      T value = 0;
+      auto const r = fast_float::from_chars_fixed_point<T, Scale>(
+          s.data(), s.data() + s.size(), value, rounding);
+      INFO("s=" << s << " scale=" << Scale << " rounding=" << int(rounding));
+      CHECK((r.ec == std::errc()) == valid);
+      if (valid) {
+        CHECK(value == expected);
+      } else {
+        CHECK(r.ec == std::errc::result_out_of_range);
+      }
+      CHECK(r.ptr == s.data() + s.size());
+    }
+  }
+}
+
+TEST_CASE("fixed_point.random") {
+  check_random<int64_t, 0>();
+  check_random<int64_t, 2>();
+  check_random<int64_t, 8>();
+  check_random<int64_t, -3>();
+  check_random<uint64_t, 4>();
+  check_random<int32_t, 2>();
+  check_random<uint32_t, 6>();
+  check_random<int16_t, 1>();
+}
+
+template <typename T, int Scale>
+void check_parses_as(std::string const &s, fixed_point_rounding rounding,
+                     std::errc ec, T expected, size_t end) {
+  INFO("s=" << s);
+  T value = 0;
+  auto const r = fast_float::from_chars_fixed_point<T, Scale>(
+      s.data(), s.data() + s.size(), value, rounding);
+  CHECK(r.ec == ec);
+  CHECK(r.ptr == s.data() + end);
+  if (ec == std::errc()) {
+    CHECK(value == expected);
+  }
+}
+
+TEST_CASE("fixed_point.examples") {
+  auto const reject = fixed_point_rounding::reject;
+  auto const even = fixed_point_rounding::nearest_even;
+  auto const away = fixed_point_rounding::nearest_away;
+  auto const zero = fixed_point_rounding::toward_zero;
+  auto const ok = std::errc();
+  auto const out = std::errc::result_out_of_range;
+  auto const invalid = std::errc::invalid_argument;
+  check_parses_as<int64_t, 2>("19.99", reject, ok, 1999, 5);
+  check_parses_as<int64_t, 4>("123.4500", reject, ok, 1234500, 8);
+  check_parses_as<int64_t, 3>("1.5e3,", reject, ok, 1500000, 5);
+  check_parses_as<int64_t, 2>("-0.125", reject, out, 0, 6);
+  check_parses_as<int64_t, 2>("-0.125", zero, ok, -12, 6);
+  check_parses_as<int64_t, 2>("-0.125", even, ok, -12, 6);
+  check_parses_as<int64_t, 2>("-0.125", away, ok, -13, 6);
+  check_parses_as<int64_t, 2>("0.135", even, ok, 14, 5);
+  check_parses_as<int64_t, 2>("0.12500000000000000000000001", even, ok, 13, 28);
+  check_parses_as<int64_t, -3>("12345", even, ok, 12, 5);
+  check_parses_as<int64_t, 0>("9223372036854775807", reject, ok,
+                              std::numeric_limits<int64_t>::max(), 19);
+  check_parses_as<int64_t, 0>("9223372036854775808", reject, out, 0, 19);
+  check_parses_as<int64_t, 0>("-9223372036854775808", reject, ok,
+                              std::numeric_limits<int64_t>::min(), 20);
+  check_parses_as<uint64_t, 0>("18446744073709551615.0", reject, ok,
+                               std::numeric_limits<uint64_t>::max(), 22);
+  check_parses_as<uint64_t, 0>("18446744073709551615.5", away, out, 0, 22);
+  check_parses_as<uint64_t, 0>("1844674407370955161.5e1", reject, ok,
+                               std::numeric_limits<uint64_t>::max(), 23);
+  check_parses_as<uint64_t, 2>("-1", reject, invalid, 0, 0);
+  check_parses_as<uint32_t, 2>("42949672.95", reject, ok, 4294967295u, 11);
+  check_parses_as<uint32_t, 2>("42949672.96", reject, out, 0, 11);
+  check_parses_as<int16_t, 1>("-3276.8", reject, ok, -32768, 7);
+  check_parses_as<int64_t, 2>("0e999999999", reject, ok, 0, 11);
+  check_parses_as<int64_t, 2>("1e999999999", reject, out, 0, 11);
+  check_parses_as<int64_t, 2>("1e-999999999", zero, ok, 0, 12);
+  check_parses_as<int64_t, 2>("1e-999999999", away, ok, 0, 12);
+  check_parses_as<int64_t, 2>("0.000000000000000000000000000000", reject, ok,
+                              0, 32);
+  check_parses_as<int64_t, 2>("00000000000000000000000000012.5", reject, ok,
+                              1250, 31);
+  for (std::string const s : {"", ".", "-", "e5", "inf", "nan", "-infinity"}) {
+    check_parses_as<int64_t, 2>(s, zero, invalid, 0, 0);
+  }
+  // Only decimal numbers.
+  check_parses_as<int64_t, 2>("0x10", reject, ok, 0, 1);
+}
+
+TEST_CASE("fixed_point.options") {
+  std::string s = "  12,5;";
+  int64_t value = 0;
+  auto r = fast_float::from_chars_fixed_point<int64_t, 2>(
+      s.data(), s.data() + s.size(), value, fixed_point_rounding::reject,
+      fast_float::parse_options(chars_format::general |
+                                    chars_format::skip_white_space,
+                                ','));
+  CHECK(r.ec == std::errc());
+  CHECK(r.ptr == s.data() + 6);
+  CHECK(value == 1250);
+  s = "+1.5";
+  r = fast_float::from_chars_fixed_point<int64_t, 2>(
+      s.data(), s.data() + s.size(), value);
+  CHECK(r.ec == std::errc::invalid_argument);
+  r = fast_float::from_chars_fixed_point<int64_t, 2>(
+      s.data(), s.data() + s.size(), value, fixed_point_rounding::reject,
+      fast_float::parse_options(chars_format::general |
+                                chars_format::allow_leading_plus));
+  CHECK(r.ec == std::errc());
+  CHECK(value == 150);
+  s = "1e2";
+  r = fast_float::from_chars_fixed_point<int64_t, 2>(
+      s.data(), s.data() + s.size(), value, fixed_point_rounding::reject,
+      fast_float::parse_options(chars_format::fixed));
+  CHECK(r.ptr == s.data() + 1);
+  CHECK(value == 100);
+  s = "01.5";
+  r = fast_float::from_chars_fixed_point<int64_t, 2>(
+      s.data(), s.data() + s.size(), value, fixed_point_rounding::reject,
+      fast_float::parse_options(chars_format::json));
+  CHECK(r.ec == std::errc::invalid_argument);
+}
+
+template <typename UC> void check_wide() {
+  std::string const narrow = "-1234567.891234567890123e-3";
+  std::basic_string<UC> const s(narrow.begin(), narrow.end());
+  int64_t value = 0;
+  auto const r = fast_float::from_chars_fixed_point<int64_t, 6>(
+      s.data(), s.data() + s.size(), value,
+      fixed_point_rounding::nearest_even);
+  CHECK(r.ec == std::errc());
+  CHECK(r.ptr == s.data() + s.size());
+  CHECK(value == -1234567891);
+}
+
+TEST_CASE("fixed_point.wide") {
+  check_wide<char16_t>();
+  check_wide<char32_t>();
+  check_wide<wchar_t>();
+}
+
+#if FASTFLOAT_IS_CONSTEXPR
+constexpr int64_t parse_cents(char const *s, size_t length) {
+  int64_t value = 0;
+  fast_float::from_chars_fixed_point<int64_t, 2>(s, s + length, value);
+  return value;
+}
+static_assert(parse_cents("-19.99", 6) == -1999, "constexpr parse failed");
+static_assert(parse_cents("0.12345678901234567890e2", 24) == 0,
+              "constexpr parse failed");
+static_assert(parse_cents("0.12345678901234567890e17", 25) ==
+                  1234567890123456789,
+              "constexpr parse failed");
+#endif
@@ -0,0 +1,282 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest/doctest.h"
+
+#include "fast_float/fast_float.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <string>
+#include <system_error>
+#include <vector>
+
+using fast_float::chars_format;
+
+template <typename T> T strto(char const *s, char **end);
+template <> double strto<double>(char const *s, char **end) {
+  return std::strtod(s, end);
+}
+template <> float strto<float>(char const *s, char **end) {
+  return std::strtof(s, end);
+}
+
+// The value and the end of a "0x" number must be those of strtod, which rounds
+// correctly; the values out of range are infinite or zero.
+template <typename T> void check_same_as_strto(std::string const &s) {
+  INFO("s=" << s);
+  char *end;
+  T const expected = strto<T>(s.c_str(), &end);
+  for (chars_format fmt : {chars_format::general | chars_format::hex,
+                           chars_format::scientific | chars_format::hex}) {
+    T value;
+    auto const r = fast_float::from_chars_advanced(
+        s.data(), s.data() + s.size(), value, fast_float::parse_options(fmt));
+    CHECK(std::memcmp(&value, &expected, sizeof(T)) == 0);
+    CHECK(r.ptr == s.data() + (end - s.c_str()));
+    bool const out_of_range =
+        (expected == 0 && s.find_first_of("123456789abcdefABCDEF", 2) <
+                              s.find_first_of("pP")) ||
+        expected == std::numeric_limits<T>::infinity() ||
+        expected == -std::numeric_limits<T>::infinity();
+    CHECK((r.ec == std::errc::result_out_of_range) == out_of_range);
+  }
+  // Without the prefix, with chars_format::hex alone.
+  std::string const bare = s[0] == '-' ? "-" + s.substr(3) : s.substr(2);
+  T value;
+  auto const r = fast_float::from_chars(bare.data(), bare.data() + bare.size(),
+                                        value, chars_format::hex);
+  CHECK(std::memcmp(&value, &expected, sizeof(T)) == 0);
+  CHECK(r.ptr == bare.data() + (end - s.c_str()) - (s.size() - bare.size()));
+}
+
+// Round trips of %a.
+template <typename T> void check_round_trip() {
+  std::mt19937_64 rng(42);
+  for (int i = 0; i < 100000; i++) {
+    uint64_t bits = rng();
+    T x;
+    std::memcpy(&x, &bits, sizeof(T));
+    if (x != x) {
+      continue;
+    }
+    char buffer[64];
+    std::snprintf(buffer, sizeof(buffer), "%a", double(x));
+    T value;
+    auto const r = fast_float::from_chars(buffer, buffer + std::strlen(buffer),
+                                          value,
+                                          chars_format::general |
+                                              chars_format::hex);
+    CHECK((r.ec == std::errc() ||
+           (r.ec == std::errc::result_out_of_range &&
+            (x == std::numeric_limits<T>::infinity() ||
+             x == -std::numeric_limits<T>::infinity()))));
+    CHECK(r.ptr == buffer + std::strlen(buffer));
+    CHECK(std::memcmp(&value, &x, sizeof(T)) == 0);
+  }
+}
+
+TEST_CASE("hex_float.round_trip") {
+  check_round_trip<double>();
+  check_round_trip<float>();
+}
+
+// Long mantissas, ties, subnormals and the limits of the exponent.
+template <typename T> void check_against_strto() {
+  std::vector<std::string> const inputs = {
+      "0x0",
+      "0x0p99999999999",
+      "-0x0.000p-3",
+      "0x1",
+      "0x1p0",
+      "0x1P+1",
+      "0x1p-1",
+      "0xA.8p1",
+      "0x.8",
+      "0x8.",
+      "0x1.8p",
+      "0x1.8p+",
+      "0x1.8q3",
+      "0x1.fffffffffffff8p1023",
+      "0x1.fffffffffffff7ffffp1023",
+      "0x1.fffffffffffffp1023",
+      "0x1p1024",
+      "0x1p-1022",
+      "0x1p-1074",
+      "0x1p-1075",
+      "0x1.0000000000001p-1075",
+      "0x1p-1076",
+      "0x0.fffffffffffff8p-1022",
+      "0x1.fffffep127",
+      "0x1.ffffffp127",
+      "0x1p-149",
+      "0x1p-150",
+      "0x1.000001p0",
+      "0x1.0000010000000000000000000000000001p0",
+      "0x1.00000000000008p0",
+      "0x1.000000000000080000000000000000000001p0",
+      "0x1.00000000000018p0",
+      "0x0000000000000000000000001.00000000000008p0",
+      "0x0.000000000000000000000000000000000000001p0",
+      "0x123456789abcdef0123456789abcdef",
+      "0x123456789ABCDEF0123456789ABCDEFp-200",
+      "0xffffffffffffffffffffffffffffffffp-300",
+      "0x1p99999999999999999999",
+      "0x1p-99999999999999999999",
+      "0x0.00000000000000000000001p99999999999999999999",
+      "0x1234567g",
+      "0x12345678g",
+      "0x12345678:",
+      "0x12345678@",
+      "0x1234567890abcdefG",
+      "0xaaaaaaaaffffffff.ffffffff12345678",
+  };
+  for (std::string const &s : inputs) {
+    check_same_as_strto<T>(s);
+    if (s[0] != '-') {
+      check_same_as_strto<T>("-" + s);
+    }
+  }
+  std::mt19937_64 rng(7);
+  char const digits[] = "0123456789abcdefABCDEF";
+  for (int i = 0; i < 100000; i++) {
+    std::string s = "0x";
+    size_t const length = size_t(rng() % 40);
+    size_t const point = size_t(rng() % (length + 1));
+    for (size_t j = 0; j < length; j++) {
+      if (j == point) {
+        s.push_back('.');
+      }
+      // Mostly zeros, to make ties and long runs.
+      s.push_back(rng() % 3 == 0 ? digits[rng() % 22] : '0');
+    }
+    if (s.size() == 2) {
+      s.push_back('1');
+    }
+    s += "p" + std::to_string(int(rng() % 2400) - 1200);
+    check_same_as_strto<T>(s);
+  }
+}
+
+TEST_CASE("hex_float.against_strto") {
+  check_against_strto<double>();
+  check_against_strto<float>();
+}
+
+TEST_CASE("hex_float.formats") {
+  double d;
+  std::string s = "0x1.8p1";
+  // Without chars_format::hex, the "0x" is not read.
+  auto r = fast_float::from_chars(s.data(), s.data() + s.size(), d);
+  CHECK(r.ec == std::errc());
+  CHECK(r.ptr == s.data() + 1);
+  CHECK(d == 0);
+  // With chars_format::hex alone, neither.
+  r = fast_float::from_chars(s.data(), s.data() + s.size(), d,
+                             chars_format::hex);
+  CHECK(r.ptr == s.data() + 1);
+  CHECK(d == 0);
+  // With both, the decimal numbers are still parsed.
+  for (std::string const decimal : {"1.5e3", "-2", "0", "0x", "-0x.p1"}) {
+    double expected;
+    fast_float::from_chars(decimal.data(), decimal.data() + decimal.size(),
+                           expected);
+    r = fast_float::from_chars(decimal.data(), decimal.data() + decimal.size(),
+                               d, chars_format::general | chars_format::hex);
+    CHECK(r.ec == std::errc());
+    CHECK(d == expected);
+  }
+  s = "+0x10";
+  r = fast_float::from_chars(s.data(), s.data() + s.size(), d,
+                             chars_format::general | chars_format::hex);
+  CHECK(r.ec == std::errc::invalid_argument);
+  r = fast_float::from_chars(s.data(), s.data() + s.size(), d,
+                             chars_format::general | chars_format::hex |
+                                 chars_format::allow_leading_plus);
+  CHECK(r.ec == std::errc());
+  CHECK(d == 16);
+  // Infinity and NaN, and the decimal point.
+  s = "-inf";
+  r = fast_float::from_chars(s.data(), s.data() + s.size(), d,
+                             chars_format::hex);
+  CHECK(r.ec == std::errc());
+  CHECK(d == -std::numeric_limits<double>::infinity());
+  r = fast_float::from_chars(s.data(), s.data() + s.size(), d,
+                             chars_format::hex | chars_format::no_infnan);
+  CHECK(r.ec == std::errc::invalid_argument);
+  s = "a,8p-2";
+  r = fast_float::from_chars_advanced(
+      s.data(), s.data() + s.size(), d,
+      fast_float::parse_options(chars_format::hex, ','));
+  CHECK(r.ec == std::errc());
+  CHECK(d == 2.625);
+  for (std::string const invalid : {"", ".", "p1", "-", "x1", ".p1"}) {
+    r = fast_float::from_chars(invalid.data(), invalid.data() + invalid.size(),
+                               d, chars_format::hex);
+    CHECK(r.ec == std::errc::invalid_argument);
+  }
+  // Just over half of the smallest subnormal, which glibc's strtof rounds down.
+  s = "0x1.000001p-150";
+  float f;
+  r = fast_float::from_chars(s.data(), s.data() + s.size(), f,
+                             chars_format::general | chars_format::hex);
+  CHECK(r.ec == std::errc());
+  CHECK(f == std::numeric_limits<float>::denorm_min());
+}
+
+// Wide code units, with units that look like digits once narrowed.
+template <typename UC> void check_wide() {
+  std::string const narrow = "-0x123456789abcdef.ABCDEF01p-4";
+  std::basic_string<UC> const s(narrow.begin(), narrow.end());
+  double d;
+  auto r = fast_float::from_chars(s.data(), s.data() + s.size(), d,
+                                  chars_format::general | chars_format::hex);
+  CHECK(r.ec == std::errc());
+  CHECK(r.ptr == s.data() + s.size());
+  CHECK(d == std::strtod(narrow.c_str(), nullptr));
+  for (uint32_t unit : {0x130u, 0x141u, 0x166u, 0xFF30u}) {
+    for (size_t at = 4; at < 20; at++) {
+      std::basic_string<UC> t = s;
+      t[at] = UC(unit);
+      r = fast_float::from_chars(t.data(), t.data() + t.size(), d,
+                                 chars_format::general | chars_format::hex);
+      CHECK(r.ptr == t.data() + at);
+    }
+  }
+}
+
+TEST_CASE("hex_float.wide") {
+  check_wide<char16_t>();
+  check_wide<char32_t>();
+  check_wide<wchar_t>();
+}
+
+TEST_CASE("hex_float.many") {
+  std::string const s = "0x1p1 -0x.8 0x10 1.5 0xAp-1";
+  double out[6];
+  auto r = fast_float::from_chars_many(
+      s.data(), s.data() + s.size(), out, 6,
+      fast_float::separator_set::white_space(),
+      fast_float::parse_options(chars_format::general | chars_format::hex));
+  CHECK(r.ec == std::errc());
+  CHECK(r.count == 5);
+  CHECK(out[0] == 2);
+  CHECK(out[1] == -0.5);
+  CHECK(out[2] == 16);
+  CHECK(out[3] == 1.5);
+  CHECK(out[4] == 5);
+}
+
+#if FASTFLOAT_IS_CONSTEXPR
+constexpr double parse_hex(char const *s, size_t length) {
+  double value = 0;
+  fast_float::from_chars(s, s + length, value,
+                         chars_format::general | chars_format::hex);
+  return value;
+}
+static_assert(parse_hex("0x1.8p-1", 8) == 0.75, "constexpr parse failed");
+static_assert(parse_hex("0x123456789abcdefp4", 19) == 1311768467463790320.0,
+              "constexpr parse failed");
+#endif
@@ -0,0 +1,139 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest/doctest.h"
+
+#include "fast_float/fast_float.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <string>
+#include <system_error>
+
+template <typename T> T reference(char const *s);
+template <> double reference<double>(char const *s) {
+  return std::strtod(s, nullptr);
+}
+template <> float reference<float>(char const *s) {
+  return std::strtof(s, nullptr);
+}
+
+template <typename T> void check_same_as_reference(std::string const &s) {
+  T value{};
+  auto const r = fast_float::from_chars(s.data(), s.data() + s.size(), value);
+  T const expected = reference<T>(s.c_str());
+  INFO("s=" << s);
+  CHECK(r.ptr == s.data() + s.size());
+  CHECK(std::memcmp(&value, &expected, sizeof(T)) == 0);
+}
+
+// Adds one unit in the last place to a string of digits.
+std::string increment(std::string digits) {
+  for (size_t i = digits.size(); i-- > 0;) {
+    if (digits[i] != '9') {
+      digits[i]++;
+      return digits;
+    }
+    digits[i] = '0';
+  }
+  return "1" + digits;
+}
+
+// `scientific` is the output of printf("%.Ne"), e.g., the exact value of a
+// point halfway between two floats. Checks the prefixes of its digits, of 20
+// to 45 significant digits, and the prefixes rounded up, which are on both
+// sides of the halfway point.
+template <typename T> void check_prefixes(std::string const &scientific) {
+  size_t const e = scientific.find('e');
+  std::string digits = scientific.substr(0, 1) + scientific.substr(2, e - 2);
+  int const exponent = std::atoi(scientific.c_str() + e + 1);
+  for (size_t n = 20; n <= digits.size(); n++) {
+    std::string const prefix = digits.substr(0, n);
+    for (std::string const &d : {prefix, increment(prefix)}) {
+      // d[0].d[1...] x 10^exponent, with the decimal point moved around.
+      for (int point : {1, 3, int(d.size()), int(d.size()) + 4}) {
+        std::string s;
+        if (point <= int(d.size())) {
+          s = d.substr(0, size_t(point)) + "." + d.substr(size_t(point));
+        } else {
+          s = d + std::string(size_t(point) - d.size(), '0');
+        }
+        s += "e" + std::to_string(exponent - point + 1);
+        check_same_as_reference<T>(s);
+      }
+    }
+  }
+}
+
+// Halfway points between doubles are exact in a long double when it has at
+// least 64 bits of mantissa. Above 2^64, these points are integers with 20 to
+// 38 digits, whose parse can be right in between two doubles.
+TEST_CASE("long_mantissa.double_halfway") {
+  std::mt19937_64 rng(2024);
+  if (std::numeric_limits<long double>::digits < 64) {
+    MESSAGE("skipping the double halfway test");
+    return;
+  }
+  char buffer[128];
+  for (int i = 0; i < 4000; i++) {
+    // Mostly the exponents of 20 to 38 digit integers, and any others.
+    int const exp2 = (i % 2 == 0) ? int(rng() % 64) + 64
+                                  : int(rng() % 2000) - 1000;
+    double const d = std::ldexp(double(rng() >> 11), exp2 - 53);
+    double const next = std::nextafter(d, HUGE_VAL);
+    if (d == 0 || std::isinf(next)) {
+      continue;
+    }
+    long double const half = (static_cast<long double>(d) + next) / 2;
+    std::snprintf(buffer, sizeof(buffer), "%.44Le", half);
+    check_prefixes<double>(buffer);
+    if (exp2 >= 64 && exp2 < 128) {
+      std::snprintf(buffer, sizeof(buffer), "%.0Lf", half);
+      check_same_as_reference<double>(buffer);
+    }
+  }
+}
+
+// Halfway points between floats are exact in a double.
+TEST_CASE("long_mantissa.float_halfway") {
+  std::mt19937_64 rng(2024);
+  char buffer[128];
+  for (int i = 0; i < 4000; i++) {
+    int const exp2 = (i % 2 == 0) ? int(rng() % 64) + 64
+                                  : int(rng() % 260) - 130;
+    float const f = std::ldexp(float(rng() >> 40), exp2 - 24);
+    float const next = std::nextafter(f, HUGE_VALF);
+    if (f == 0 || std::isinf(next)) {
+      continue;
+    }
+    double const half = (double(f) + double(next)) / 2;
+    std::snprintf(buffer, sizeof(buffer), "%.44e", half);
+    check_prefixes<float>(buffer);
+    if (exp2 >= 64 && exp2 < 128) {
+      std::snprintf(buffer, sizeof(buffer), "%.0f", half);
+      check_same_as_reference<float>(buffer);
+    }
+  }
+}
+
+// Values printed with 17 digits, followed by noise digits.
+TEST_CASE("long_mantissa.noise_digits") {
+  std::mt19937_64 rng(2024);
+  char buffer[128];
+  for (int i = 0; i < 20000; i++) {
+    double const d = std::ldexp(double(rng() >> 11), int(rng() % 400) - 200);
+    std::snprintf(buffer, sizeof(buffer), "%.16e", d);
+    std::string s = buffer;
+    size_t const e = s.find('e');
+    std::string noise;
+    for (size_t n = 3 + rng() % 19; n > 0; n--) {
+      noise.push_back(char('0' + rng() % 10));
+    }
+    s.insert(e, noise);
+    check_same_as_reference<double>(s);
+    check_same_as_reference<float>(s);
+  }
+}
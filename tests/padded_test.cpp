@@ -0,0 +1,82 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest/doctest.h"
+
+#include "fast_float/fast_float.h"
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <system_error>
+
+// Parses input[0, length) with from_chars_padded, the rest of the input
+// being the padding, and checks that the result matches from_chars_advanced.
+template <typename T>
+void check_same_as_advanced(std::string const &input, size_t length,
+                            fast_float::parse_options options =
+                                fast_float::parse_options()) {
+  REQUIRE(input.size() >= length + fast_float::from_chars_padding);
+  char const *first = input.data();
+  char const *last = first + length;
+  T expected{};
+  T value{};
+  auto const r1 = fast_float::from_chars_advanced(first, last, expected,
+                                                  options);
+  auto const r2 = fast_float::from_chars_padded(first, last, value, options);
+  CHECK(r1.ec == r2.ec);
+  CHECK(r1.ptr == r2.ptr);
+  if (r1.ec == std::errc()) {
+    CHECK(value == expected);
+  }
+}
+
+// Every prefix of the input, with digits, a non-digit or zeros as padding.
+template <typename T>
+void check_all_prefixes(std::string const &number) {
+  for (char const fill : {'7', '0', 'x', ' '}) {
+    std::string const input =
+        number + std::string(fast_float::from_chars_padding, fill);
+    for (size_t length = 0; length <= number.size(); length++) {
+      check_same_as_advanced<T>(input, length);
+    }
+  }
+}
+
+TEST_CASE("from_chars_padded.integers") {
+  std::string digits;
+  for (size_t n = 0; n <= 24; n++) {
+    check_all_prefixes<uint64_t>(digits);
+    check_all_prefixes<int64_t>("-" + digits);
+    check_all_prefixes<uint32_t>(digits);
+    check_all_prefixes<uint8_t>(digits);
+    check_all_prefixes<int>(digits + "x12345678");
+    digits.push_back(char('0' + (n * 7 + 3) % 10));
+  }
+  for (std::string const number :
+       {"18446744073709551615", "18446744073709551616", "0000000000000000001",
+        "9223372036854775807", "-9223372036854775808", "123456789 987654321",
+        "12345678.5"}) {
+    check_all_prefixes<uint64_t>(number);
+    check_all_prefixes<int64_t>(number);
+  }
+  std::mt19937_64 rng(1);
+  for (int i = 0; i < 10000; i++) {
+    std::string const number = std::to_string(rng() >> (rng() % 64));
+    check_all_prefixes<uint64_t>(number);
+  }
+}
+
+TEST_CASE("from_chars_padded.other_bases_and_floats") {
+  fast_float::parse_options const hex(fast_float::chars_format::general, '.',
+                                      16);
+  std::string const input =
+      "ffffffff12" + std::string(fast_float::from_chars_padding, 'f');
+  for (size_t length = 0; length <= 10; length++) {
+    check_same_as_advanced<uint64_t>(input, length, hex);
+  }
+  for (std::string const number :
+       {"3.1415926535897932384626", "1e308", "-0.000001234", "12345678901234",
+        "inf", "1.5e"}) {
+    check_all_prefixes<double>(number);
+    check_all_prefixes<float>(number);
+  }
+}
@@ -0,0 +1,127 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest/doctest.h"
+
+#include "fast_float/parallel_parse.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <system_error>
+#include <vector>
+
+// Checks that the parallel parse, with the given threads and chunk size, gives
+// exactly the result of the serial parse.
+template <typename T, typename UC>
+void check_same_as_serial(std::basic_string<UC> const &input, size_t max,
+                          unsigned thread_count, size_t chunk_size,
+                          fast_float::separator_set separators =
+                              fast_float::separator_set::white_space()) {
+  UC const *first = input.data();
+  UC const *last = input.data() + input.size();
+  std::vector<T> expected(max + 1);
+  std::vector<T> out(max + 1);
+  auto const serial = fast_float::from_chars_many(
+      first, last, expected.data(), max, separators,
+      fast_float::parse_options_t<UC>());
+  auto const parallel = fast_float::detail::parse_many_parallel(
+      first, last, out.data(), max, thread_count, chunk_size, separators,
+      fast_float::parse_options_t<UC>());
+  CHECK(parallel.ec == serial.ec);
+  CHECK(parallel.ptr == serial.ptr);
+  CHECK(parallel.count == serial.count);
+  for (size_t i = 0; i < serial.count; i++) {
+    CHECK(out[i] == expected[i]);
+  }
+}
+
+std::string random_input(std::mt19937_64 &rng, size_t count, bool errors) {
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  std::string input;
+  char buffer[64];
+  for (size_t i = 0; i < count; i++) {
+    double const v = dist(rng) * std::ldexp(1.0, int(rng() % 64) - 32);
+    int const len =
+        std::snprintf(buffer, sizeof(buffer), (i % 2) ? "%.17g" : "%g", v);
+    input.append(buffer, size_t(len));
+    if (errors && rng() % 500 == 0) {
+      input.push_back('x');
+    }
+    // Runs of separators of various lengths.
+    input.append(1 + rng() % 3 + (rng() % 50 == 0 ? 70 : 0),
+                 (i % 3) ? ' ' : '\n');
+  }
+  return input;
+}
+
+TEST_CASE("from_chars_many_parallel.random") {
+  std::mt19937_64 rng(42);
+  for (int round = 0; round < 20; round++) {
+    std::string const input = random_input(rng, 2000, round % 2 == 1);
+    for (unsigned threads : {2u, 3u, 8u}) {
+      for (size_t chunk : {1u, 17u, 64u, 1000u}) {
+        for (size_t max : {size_t(0), size_t(1), size_t(999), size_t(4000)}) {
+          check_same_as_serial<double, char>(input, max, threads, chunk);
+        }
+      }
+    }
+  }
+}
+
+TEST_CASE("from_chars_many_parallel.max_at_chunk_ends") {
+  // With one-character chunks, every number is at a chunk start or end.
+  std::string const input = " 1 22  333   4444 ";
+  for (size_t max = 0; max <= 5; max++) {
+    for (unsigned threads : {2u, 4u}) {
+      check_same_as_serial<double, char>(input, max, threads, 1);
+      check_same_as_serial<int, char>(input, max, threads, 1);
+    }
+  }
+  std::string const no_separators(300, '7');
+  check_same_as_serial<double, char>(no_separators, 4, 4, 10);
+}
+
+TEST_CASE("from_chars_many_parallel.errors") {
+  for (std::string const input :
+       {"1 2 3 4 x 6 7 8 y", "1 2 1e999 4 5", "1 2 3, 4", "1\n2\n3\n4a"}) {
+    for (unsigned threads : {2u, 4u}) {
+      for (size_t chunk : {1u, 2u, 3u, 5u}) {
+        check_same_as_serial<double, char>(input, 16, threads, chunk);
+        check_same_as_serial<double, char>(input, 2, threads, chunk);
+        check_same_as_serial<int, char>(input, 16, threads, chunk);
+      }
+    }
+  }
+}
+
+TEST_CASE("from_chars_many_parallel.separators_and_wide") {
+  std::u16string const wide = u"1.5;;2;3e2;-4;;;";
+  std::string const narrow = "1.5;;2;3e2;-4;;;";
+  fast_float::separator_set const semicolon(";");
+  for (size_t chunk : {1u, 2u, 4u}) {
+    check_same_as_serial<double, char16_t>(wide, 8, 3, chunk, semicolon);
+    check_same_as_serial<float, char>(narrow, 8, 3, chunk, semicolon);
+  }
+}
+
+TEST_CASE("from_chars_many_parallel.public_api") {
+  std::mt19937_64 rng(7);
+  std::string const input = random_input(rng, 100000, false);
+  std::vector<double> expected(100000);
+  auto const serial = fast_float::from_chars_many(
+      input.data(), input.data() + input.size(), expected.data(),
+      expected.size());
+  CHECK(serial);
+  CHECK(serial.count == expected.size());
+  for (unsigned threads : {0u, 1u, 2u, 5u}) {
+    std::vector<double> out(expected.size());
+    auto const answer = fast_float::from_chars_many_parallel(
+        input.data(), input.data() + input.size(), out.data(), out.size(),
+        threads);
+    CHECK(answer);
+    CHECK(answer.count == serial.count);
+    CHECK(answer.ptr == serial.ptr);
+    CHECK(out == expected);
+  }
+}
@@ -0,0 +1,95 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest/doctest.h"
+
+#include "fast_float/fast_float.h"
+
+#include <cfenv>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <string>
+#include <system_error>
+#include <vector>
+
+using fast_float::chars_format;
+
+std::vector<std::string> inputs() {
+  std::vector<std::string> answer = {
+      "0",    "-0",   "1",     "+1",    "1.5",    "1,5",      "-0.1",
+      ".5",   "5.",   "1e22",  "1e23",  "1e-300", "1e400",    "1d5",
+      "0x1a", "ff",   "-129",  "255",   "01",     " 3.25",    "\t\n-2",
+      "",     " ",    "-",     "inf",   "-nan",   "nan(abc)", "9007199254740993",
+      "123456789012345678901234567890", "2.2250738585072011e-308"};
+  // Short numbers, which take Clinger's fast path, where the rounding mode
+  // matters.
+  std::mt19937_64 rng(17);
+  for (int i = 0; i < 2000; i++) {
+    answer.push_back(std::to_string(rng() % 100000000) + "." +
+                     std::to_string(rng() % 1000000) + "e" +
+                     std::to_string(int(rng() % 40) - 20));
+  }
+  return answer;
+}
+
+template <typename T>
+void check_same_as_advanced(fast_float::parse_options const &options) {
+  fast_float::parse_context<T> const context(options);
+  for (std::string const &s : inputs()) {
+    INFO("s=" << s);
+    T expected{};
+    auto const e = fast_float::from_chars_advanced(
+        s.data(), s.data() + s.size(), expected, options);
+    T value{};
+    auto const r = context.parse(s.data(), s.data() + s.size(), value);
+    CHECK(r.ec == e.ec);
+    CHECK(r.ptr == e.ptr);
+    // NaN compares by bits
+    CHECK(std::memcmp(&value, &expected, sizeof(T)) == 0);
+  }
+}
+
+TEST_CASE("parse_context.options") {
+  for (fast_float::parse_options const options :
+       {fast_float::parse_options(),
+        fast_float::parse_options(chars_format::json),
+        fast_float::parse_options(chars_format::fortran),
+        fast_float::parse_options(chars_format::scientific),
+        fast_float::parse_options(chars_format::fixed | chars_format::no_infnan),
+        fast_float::parse_options(chars_format::general, ','),
+        fast_float::parse_options(chars_format::general |
+                                  chars_format::skip_white_space |
+                                  chars_format::allow_leading_plus),
+        fast_float::parse_options(chars_format::general, '.', 16),
+        fast_float::parse_options(chars_format::general, '.', 37)}) {
+    check_same_as_advanced<double>(options);
+    check_same_as_advanced<float>(options);
+    check_same_as_advanced<int>(options);
+    check_same_as_advanced<uint8_t>(options);
+    check_same_as_advanced<int64_t>(options);
+  }
+}
+
+// The context checks the rounding mode when it is built: the values are
+// correctly rounded in all the modes, as with from_chars.
+TEST_CASE("parse_context.rounding_modes") {
+  for (int mode : {FE_TONEAREST, FE_UPWARD, FE_DOWNWARD, FE_TOWARDZERO}) {
+    fesetround(mode);
+    fast_float::parse_context<double> const context;
+    CHECK(context.rounds_to_nearest() == (mode == FE_TONEAREST));
+    check_same_as_advanced<double>(fast_float::parse_options());
+    check_same_as_advanced<float>(fast_float::parse_options());
+    fesetround(FE_TONEAREST);
+  }
+}
+
+TEST_CASE("parse_context.wide") {
+  fast_float::parse_context<double, char32_t> const context(
+      fast_float::parse_options_t<char32_t>(chars_format::general |
+                                            chars_format::skip_white_space));
+  std::u32string const s = U"   -1.25e2 ";
+  double d;
+  auto const r = context.parse(s.data(), s.data() + s.size(), d);
+  CHECK(r.ec == std::errc());
+  CHECK(r.ptr == s.data() + 10);
+  CHECK(d == -125);
+}
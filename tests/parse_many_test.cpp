@@ -0,0 +1,394 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest/doctest.h"
+
+#include "fast_float/fast_float.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <string>
+#include <system_error>
+#include <vector>
+
+template <typename T, typename UC>
+fast_float::from_chars_many_result_t<UC>
+parse_all(std::basic_string<UC> const &input, std::vector<T> &out,
+          fast_float::separator_set separators =
+              fast_float::separator_set::white_space(),
+          fast_float::parse_options_t<UC> options =
+              fast_float::parse_options_t<UC>()) {
+  return fast_float::from_chars_many(input.data(),
+                                     input.data() + input.size(), out.data(),
+                                     out.size(), separators, options);
+}
+
+TEST_CASE("from_chars_many.doubles") {
+  std::string const input = "  1.5 -2\n3e2\t\t0.25  \n";
+  std::vector<double> out(8);
+  auto answer = parse_all(input, out);
+  CHECK(answer);
+  CHECK(answer.count == 4);
+  CHECK(answer.ptr == input.data() + input.size());
+  CHECK(out[0] == 1.5);
+  CHECK(out[1] == -2);
+  CHECK(out[2] == 300);
+  CHECK(out[3] == 0.25);
+}
+
+TEST_CASE("from_chars_many.empty") {
+  std::vector<double> out(2);
+  std::string const empty;
+  auto answer = parse_all(empty, out);
+  CHECK(answer);
+  CHECK(answer.count == 0);
+  CHECK(answer.ptr == empty.data());
+  std::string const blank = " \n ";
+  answer = parse_all(blank, out);
+  CHECK(answer);
+  CHECK(answer.count == 0);
+  CHECK(answer.ptr == blank.data() + blank.size());
+}
+
+TEST_CASE("from_chars_many.max_and_resume") {
+  std::string const input = "1 2 3 4 5";
+  std::vector<double> out(2);
+  auto answer = parse_all(input, out);
+  CHECK(answer);
+  CHECK(answer.count == 2);
+  CHECK(answer.ptr == input.data() + 4);
+  CHECK(out[0] == 1);
+  CHECK(out[1] == 2);
+  answer = fast_float::from_chars_many(answer.ptr, input.data() + input.size(),
+                                       out.data(), out.size());
+  CHECK(answer);
+  CHECK(answer.count == 2);
+  CHECK(out[0] == 3);
+  CHECK(out[1] == 4);
+  answer = fast_float::from_chars_many(answer.ptr, input.data() + input.size(),
+                                       out.data(), out.size());
+  CHECK(answer);
+  CHECK(answer.count == 1);
+  CHECK(out[0] == 5);
+  CHECK(answer.ptr == input.data() + input.size());
+}
+
+TEST_CASE("from_chars_many.errors") {
+  std::vector<double> out(8);
+  std::string input = "1.5 abc 2";
+  auto answer = parse_all(input, out);
+  CHECK(answer.ec == std::errc::invalid_argument);
+  CHECK(answer.count == 1);
+  CHECK(answer.ptr == input.data() + 4);
+
+  // a number must be followed by a separator
+  input = "7 1.5x 2";
+  answer = parse_all(input, out);
+  CHECK(answer.ec == std::errc::invalid_argument);
+  CHECK(answer.count == 1);
+  CHECK(answer.ptr == input.data() + 2);
+
+  input = "1 2 1e999 3";
+  answer = parse_all(input, out);
+  CHECK(answer.ec == std::errc::result_out_of_range);
+  CHECK(answer.count == 2);
+  CHECK(answer.ptr == input.data() + 4);
+
+  fast_float::parse_options json{fast_float::chars_format::json};
+  input = "1 +2";
+  answer = parse_all(input, out, fast_float::separator_set::white_space(),
+                     json);
+  CHECK(answer.ec == std::errc::invalid_argument);
+  CHECK(answer.count == 1);
+}
+
+TEST_CASE("from_chars_many.integers") {
+  std::string const input = "12,-7,,42,";
+  std::vector<int> out(8);
+  auto answer = parse_all(input, out, fast_float::separator_set(","));
+  CHECK(answer);
+  CHECK(answer.count == 3);
+  CHECK(out[0] == 12);
+  CHECK(out[1] == -7);
+  CHECK(out[2] == 42);
+
+  std::vector<uint8_t> bytes(8);
+  std::string const hex = "ff 10 100";
+  fast_float::parse_options options{fast_float::chars_format::general, '.',
+                                    16};
+  auto hex_answer = parse_all(hex, bytes,
+                              fast_float::separator_set::white_space(),
+                              options);
+  CHECK(hex_answer.ec == std::errc::result_out_of_range);
+  CHECK(hex_answer.count == 2);
+  CHECK(bytes[0] == 255);
+  CHECK(bytes[1] == 16);
+
+  options.base = 1;
+  hex_answer = parse_all(hex, bytes, fast_float::separator_set::white_space(),
+                         options);
+  CHECK(hex_answer.ec == std::errc::invalid_argument);
+  CHECK(hex_answer.count == 0);
+}
+
+TEST_CASE("from_chars_many.options") {
+  std::string const input = "3,25;-1,5";
+  std::vector<float> out(4);
+  fast_float::parse_options options{fast_float::chars_format::general, ','};
+  auto answer = parse_all(input, out, fast_float::separator_set(";"), options);
+  CHECK(answer);
+  CHECK(answer.count == 2);
+  CHECK(out[0] == 3.25f);
+  CHECK(out[1] == -1.5f);
+
+  std::string const padded = "1;  2; 3";
+  options = fast_float::parse_options{
+      fast_float::chars_format::general |
+      fast_float::chars_format::skip_white_space};
+  answer = parse_all(padded, out, fast_float::separator_set(";"), options);
+  CHECK(answer);
+  CHECK(answer.count == 3);
+  CHECK(out[2] == 3.0f);
+}
+
+TEST_CASE("from_chars_many.wide") {
+  std::u16string const input = u"1.25\n-0.5\n";
+  std::vector<double> out(4);
+  auto answer = parse_all(input, out);
+  CHECK(answer);
+  CHECK(answer.count == 2);
+  CHECK(out[0] == 1.25);
+  CHECK(out[1] == -0.5);
+  CHECK(answer.ptr == input.data() + input.size());
+}
+
+// Exercise tokens and separator runs that straddle, fill or span several
+// blocks of 64 characters.
+TEST_CASE("from_chars_many.blocks") {
+  for (size_t pad = 0; pad < 130; pad++) {
+    std::string const token =
+        "1" + std::string(pad, '7') + ".5e-" + std::to_string(pad);
+    std::string input(pad, ' ');
+    input += "12345";
+    input.append(1 + pad % 67, '\n');
+    input += token;
+    input.append(pad % 3, '\t');
+    std::vector<double> out(3);
+    auto answer = parse_all(input, out);
+    CHECK(answer);
+    CHECK(answer.count == 2);
+    CHECK(answer.ptr == input.data() + input.size());
+    double expected;
+    fast_float::from_chars(token.data(), token.data() + token.size(), expected);
+    CHECK(out[0] == 12345);
+    CHECK(out[1] == expected);
+
+    // an invalid character anywhere in a token fails it
+    input[pad + 2] = 'x';
+    answer = parse_all(input, out);
+    CHECK(answer.ec == std::errc::invalid_argument);
+    CHECK(answer.count == 0);
+    CHECK(answer.ptr == input.data() + pad);
+  }
+
+  // more separators than the vectorized classifiers handle
+  std::string const input = "1a2b3c4d5e6f7g8h9i10j" + std::string(100, 'k');
+  std::vector<int> out(16);
+  auto answer = parse_all(input, out,
+                          fast_float::separator_set("abcdefghijk"));
+  CHECK(answer);
+  CHECK(answer.count == 10);
+  CHECK(out[9] == 10);
+}
+
+// Floating-point numbers go through batches: mix in numbers taking each path
+// and check that the first error wins, wherever it is in its batch.
+TEST_CASE("from_chars_many.batches") {
+  char const *pool[] = {"1.5",
+                        "-0.25",
+                        "123456789",
+                        "1e22",
+                        "1e23",
+                        "-inf",
+                        "nan",
+                        "3.14159265358979323846264338327950288",
+                        "2.2250738585072011e-308",
+                        "1e-400",
+                        "1e999",
+                        "1.5x",
+                        "-"};
+  size_t const pool_size = sizeof(pool) / sizeof(pool[0]);
+  std::mt19937_64 rng(42);
+  for (size_t trial = 0; trial < 2000; trial++) {
+    // mostly valid numbers, with the odd bad one
+    std::vector<std::string> tokens;
+    size_t const n = size_t(rng() % 200);
+    std::string input;
+    for (size_t i = 0; i < n; i++) {
+      size_t k = size_t(rng() % (pool_size - 2));
+      if (k >= 9 && rng() % 16 != 0) {
+        k = size_t(rng() % 9);
+      }
+      if (rng() % 256 == 0) {
+        k = pool_size - 2 + size_t(rng() % 2);
+      }
+      tokens.push_back(pool[k]);
+      input += tokens.back();
+      input += (i % 5) ? " " : "\n";
+    }
+    // the expected answer, a token at a time
+    std::vector<double> expected;
+    size_t offset = 0;
+    std::errc ec = std::errc();
+    for (auto const &token : tokens) {
+      double x;
+      auto r = fast_float::from_chars(token.data(),
+                                      token.data() + token.size(), x);
+      if (r.ec != std::errc() || r.ptr != token.data() + token.size()) {
+        ec = (r.ec != std::errc()) ? r.ec : std::errc::invalid_argument;
+        break;
+      }
+      expected.push_back(x);
+      offset += token.size() + 1;
+    }
+    std::vector<double> out(n);
+    auto answer = parse_all(input, out);
+    CHECK(answer.ec == ec);
+    CHECK(answer.count == expected.size());
+    CHECK(answer.ptr == input.data() + (ec == std::errc() ? input.size()
+                                                          : offset));
+    for (size_t i = 0; i < expected.size(); i++) {
+      CHECK(std::memcmp(&out[i], &expected[i], sizeof(double)) == 0);
+    }
+  }
+}
+
+// Feeds `input` to a stream_parser in blocks of `block` characters, storing at
+// most `max` values per call.
+template <typename T, typename UC>
+fast_float::from_chars_many_result_t<UC>
+parse_stream(std::basic_string<UC> const &input, size_t block, size_t max,
+             std::vector<T> &values) {
+  fast_float::stream_parser<T, UC> parser;
+  std::vector<T> out(max);
+  for (size_t i = 0; i < input.size(); i += block) {
+    UC const *p = input.data() + i;
+    UC const *end = input.data() + std::min(i + block, input.size());
+    for (;;) {
+      auto const r = parser.feed(p, end, out.data(), max);
+      values.insert(values.end(), out.begin(), out.begin() + long(r.count));
+      if (r.ec != std::errc() || r.ptr == end) {
+        if (r.ec != std::errc()) {
+          return r;
+        }
+        break;
+      }
+      p = r.ptr;
+    }
+  }
+  T x;
+  auto const r = parser.finish(x);
+  if (r.count == 1) {
+    values.push_back(x);
+  }
+  return r;
+}
+
+TEST_CASE("from_chars_many.stream") {
+  std::string const input = "  1.25 -2e3\n 45 0.5e-1\t7 ";
+  for (std::string const &s : {input, input.substr(0, input.size() - 1)}) {
+    std::vector<double> expected(8);
+    auto const serial = parse_all(s, expected);
+    expected.resize(serial.count);
+    for (size_t block = 1; block <= s.size(); block++) {
+      for (size_t max : {size_t(1), size_t(2), size_t(8)}) {
+        std::vector<double> values;
+        auto const answer = parse_stream(s, block, max, values);
+        CHECK(answer);
+        CHECK(answer.ptr == nullptr);
+        CHECK(values == expected);
+      }
+    }
+  }
+  std::u16string const wide = u"12 345 6";
+  for (size_t block = 1; block <= wide.size(); block++) {
+    std::vector<int> values;
+    CHECK(parse_stream(wide, block, 2, values));
+    CHECK((values == std::vector<int>{12, 345, 6}));
+  }
+
+  // A number split between blocks is only checked once complete.
+  for (size_t block = 1; block <= 6; block++) {
+    std::vector<double> values;
+    auto const answer = parse_stream(std::string("1 2.5x 3"), block, 4, values);
+    CHECK(answer.ec == std::errc::invalid_argument);
+    CHECK((values == std::vector<double>{1}));
+  }
+
+  // Long numbers may only be split up to max_split_length().
+  size_t const limit = fast_float::stream_parser<double>::max_split_length();
+  std::string const long_number(limit, '1');
+  std::vector<double> values;
+  CHECK(parse_stream(long_number + " 2", 7, 4, values));
+  CHECK(values.size() == 2);
+  CHECK(values[0] > 1e255);
+  CHECK(values[1] == 2);
+  values.clear();
+  auto const answer = parse_stream(long_number + "1 2", 7, 4, values);
+  CHECK(answer.ec == std::errc::value_too_large);
+  CHECK(values.empty());
+}
+
+// from_chars_many must agree with a loop of from_chars calls.
+TEST_CASE("from_chars_many.random") {
+  std::mt19937_64 rng(1234);
+  std::uniform_real_distribution<double> dist(-1e10, 1e10);
+  std::vector<double> expected;
+  std::string input;
+  char buffer[64];
+  for (size_t i = 0; i < 10000; i++) {
+    double const v = dist(rng) * std::ldexp(1.0, int(rng() % 64) - 32);
+    int const len =
+        std::snprintf(buffer, sizeof(buffer), (i % 2) ? "%.17g" : "%g", v);
+    input.append(buffer, size_t(len));
+    input.push_back((i % 3) ? ' ' : '\n');
+    double x;
+    fast_float::from_chars(buffer, buffer + len, x);
+    expected.push_back(x);
+  }
+  std::vector<double> out(expected.size());
+  auto answer = parse_all(input, out);
+  CHECK(answer);
+  CHECK(answer.count == expected.size());
+  CHECK(out == expected);
+}
+
+// With chars_format::skip_white_space and separators that are not white
+// space, the last token may be only white space: it is invalid, and the parse
+// must not read past the end of the buffer (which is exactly sized here).
+template <typename T> void check_white_space_tail() {
+  fast_float::parse_options const options(
+      fast_float::chars_format::general |
+      fast_float::chars_format::skip_white_space);
+  char const text[] = "1, ";
+  size_t const size = sizeof(text) - 1;
+  std::unique_ptr<char[]> buffer(new char[size]);
+  std::memcpy(buffer.get(), text, size);
+  T out[4];
+  auto answer = fast_float::from_chars_many(buffer.get(), buffer.get() + size,
+                                            out, 4,
+                                            fast_float::separator_set(","),
+                                            options);
+  CHECK(answer.ec == std::errc::invalid_argument);
+  CHECK(answer.count == 1);
+  CHECK(out[0] == 1);
+  CHECK(answer.ptr == buffer.get() + 2);
+}
+
+TEST_CASE("from_chars_many.white_space_tail") {
+  check_white_space_tail<double>();
+  check_white_space_tail<int>();
+}
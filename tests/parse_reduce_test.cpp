@@ -0,0 +1,199 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest/doctest.h"
+
+#include "fast_float/fast_float.h"
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+#include <system_error>
+#include <vector>
+
+using fast_float::separator_set;
+
+template <typename Reducer, typename UC = char>
+fast_float::from_chars_many_result_t<UC>
+reduce(std::basic_string<UC> const &s, Reducer &reducer,
+       separator_set separators = separator_set::white_space()) {
+  return fast_float::parse_reduce(s.data(), s.data() + s.size(), separators,
+                                  reducer);
+}
+
+TEST_CASE("parse_reduce.sum") {
+  std::string const s = " 1 2 3.5\n";
+  fast_float::sum_reducer<double> sum;
+  auto r = reduce(s, sum);
+  CHECK(r);
+  CHECK(r.count == 3);
+  CHECK(r.ptr == s.data() + s.size());
+  CHECK(sum.sum() == 6.5);
+  CHECK(sum.count() == 3);
+  CHECK(sum.mean() == 6.5 / 3);
+  // The ones are lost in a plain sum, but not with the compensation.
+  std::string big = "1e16";
+  for (int i = 0; i < 1000; i++) {
+    big += " 1";
+  }
+  fast_float::sum_reducer<double> compensated;
+  CHECK(reduce(big, compensated));
+  CHECK(compensated.sum() == 1e16 + 1000);
+  fast_float::sum_reducer<double> infinite;
+  CHECK(reduce(std::string("1 inf 2"), infinite));
+  CHECK(infinite.sum() == std::numeric_limits<double>::infinity());
+  fast_float::sum_reducer<double> not_a_number;
+  CHECK(reduce(std::string("1 inf -inf 2"), not_a_number));
+  CHECK(std::isnan(not_a_number.sum()));
+  fast_float::sum_reducer<int64_t> integers;
+  CHECK(reduce(std::string("-5,4000000000,1"), integers, separator_set(",")));
+  CHECK(integers.sum() == 3999999996);
+  CHECK(integers.mean() == 1333333332.0);
+}
+
+TEST_CASE("parse_reduce.min_max") {
+  fast_float::min_reducer<double> lowest;
+  fast_float::max_reducer<double> highest;
+  CHECK(reduce(std::string(""), lowest));
+  CHECK(lowest.min() == std::numeric_limits<double>::infinity());
+  CHECK(reduce(std::string("3 nan -2.5 7"), lowest));
+  CHECK(reduce(std::string("3 nan -2.5 7"), highest));
+  CHECK(lowest.min() == -2.5);
+  CHECK(highest.max() == 7);
+  fast_float::max_reducer<int> ints;
+  CHECK(ints.max() == std::numeric_limits<int>::min());
+  CHECK(reduce(std::string("-3 -7"), ints));
+  CHECK(ints.max() == -3);
+}
+
+TEST_CASE("parse_reduce.histogram") {
+  std::string s;
+  for (int i = 0; i < 100; i++) {
+    s += std::to_string(i) + ".5 ";
+  }
+  s += "-1 100 nan";
+  fast_float::histogram_reducer<double, 10> histogram(0, 100);
+  CHECK(histogram.size() == 10);
+  auto r = reduce(s, histogram);
+  CHECK(r);
+  CHECK(r.count == 103);
+  for (size_t i = 0; i < 10; i++) {
+    CHECK(histogram.count(i) == 10);
+  }
+  CHECK(histogram.underflow() == 1);
+  CHECK(histogram.overflow() == 2);
+  fast_float::histogram_reducer<uint16_t, 4> ports(0, 65535);
+  CHECK(reduce(std::string("22 80 443 8080 65535"), ports));
+  CHECK(ports.count(0) == 4);
+  CHECK(ports.overflow() == 1);
+}
+
+// The values before an error are folded, as from_chars_many stores them.
+TEST_CASE("parse_reduce.errors") {
+  std::string s;
+  for (int i = 0; i < 100; i++) {
+    s += "1 ";
+  }
+  s += "x 1";
+  fast_float::count_reducer<double> count;
+  auto r = reduce(s, count);
+  CHECK(r.ec == std::errc::invalid_argument);
+  CHECK(r.count == 100);
+  CHECK(r.ptr == s.data() + 200);
+  CHECK(count.count() == 100);
+  fast_float::sum_reducer<uint8_t> bytes;
+  std::string const small = "1 2 300 4";
+  r = reduce(small, bytes);
+  CHECK(r.ec == std::errc::result_out_of_range);
+  CHECK(r.count == 2);
+  CHECK(r.ptr == small.data() + 4);
+  CHECK(bytes.sum() == 3);
+  // The reducer keeps its state from one call to the next.
+  CHECK(reduce(std::string("5 6"), bytes));
+  CHECK(bytes.sum() == 14);
+  CHECK(bytes.count() == 4);
+}
+
+// A reducer of the caller: the values that are larger than the previous one.
+struct rises {
+  using value_type = float;
+  float previous = std::numeric_limits<float>::infinity();
+  size_t count = 0;
+  void operator()(float x) {
+    count += size_t(x > previous);
+    previous = x;
+  }
+};
+
+TEST_CASE("parse_reduce.custom") {
+  rises r;
+  CHECK(reduce(std::string("1;2;3;2;5"), r, separator_set(";")));
+  CHECK(r.count == 3);
+}
+
+template <typename UC> void check_wide() {
+  std::string const narrow = "1.5 -2 3e2";
+  std::basic_string<UC> s(narrow.begin(), narrow.end());
+  fast_float::sum_reducer<double> sum;
+  auto r = reduce(s, sum);
+  CHECK(r);
+  CHECK(r.count == 3);
+  CHECK(sum.sum() == 299.5);
+}
+
+TEST_CASE("parse_reduce.wide") {
+  check_wide<char16_t>();
+  check_wide<char32_t>();
+  check_wide<wchar_t>();
+}
+
+template <typename T> void check_random() {
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> dist(-1e6, 1e6);
+  char const *separators[] = {" ", "\n", ", ", ";"};
+  for (size_t n = 0; n < 200; n++) {
+    std::string s;
+    size_t const count = rng() % 1000;
+    char const *separator = separators[rng() % 4];
+    for (size_t i = 0; i < count; i++) {
+      s += std::to_string(T(dist(rng))) + separator;
+    }
+    std::vector<T> values(count);
+    auto expected = fast_float::from_chars_many(
+        s.data(), s.data() + s.size(), values.data(), count,
+        separator_set(separator));
+    CHECK(expected.count == count);
+    fast_float::min_reducer<T> lowest;
+    fast_float::max_reducer<T> highest;
+    fast_float::count_reducer<T> counted;
+    auto r = fast_float::parse_reduce(s.data(), s.data() + s.size(),
+                                      separator_set(separator), lowest);
+    CHECK(r.ptr == expected.ptr);
+    CHECK(r.count == count);
+    CHECK(reduce(s, highest, separator_set(separator)));
+    CHECK(reduce(s, counted, separator_set(separator)));
+    T expected_min = std::numeric_limits<T>::infinity();
+    T expected_max = -std::numeric_limits<T>::infinity();
+    for (T x : values) {
+      expected_min = (x < expected_min) ? x : expected_min;
+      expected_max = (x > expected_max) ? x : expected_max;
+    }
+    CHECK(lowest.min() == expected_min);
+    CHECK(highest.max() == expected_max);
+    CHECK(counted.count() == count);
+  }
+}
+
+TEST_CASE("parse_reduce.random") {
+  check_random<double>();
+  check_random<float>();
+}
+
+#if FASTFLOAT_IS_CONSTEXPR
+constexpr double constexpr_sum(char const *s, size_t n) {
+  fast_float::sum_reducer<double> sum;
+  fast_float::parse_reduce(s, s + n, separator_set::white_space(), sum);
+  return sum.sum();
+}
+static_assert(constexpr_sum("1.5 2 -0.5", 10) == 3, "constexpr");
+#endif
@@ -0,0 +1,112 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest/doctest.h"
+
+#include "fast_float/fast_float.h"
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <system_error>
+#include <vector>
+
+// The white space of is_space, and code units that are not white space but
+// look like it once narrowed to 8 bits.
+char const spaces[] = {' ', '\t', '\n', '\v', '\f', '\r'};
+uint32_t const not_spaces[] = {0x08, 0x0E, 0x1F, 0x21, 0x85, 0xA0,
+                               0x120, 0x209, 0x10020, 0x7FFF0020};
+
+template <typename UC> bool fits(uint32_t unit) {
+  return unit <= uint32_t(std::numeric_limits<UC>::max());
+}
+
+// Runs of all lengths, across the 16- and 32-code-unit blocks, before a
+// number, with and without a code unit that ends the run early.
+template <typename UC> void check_runs() {
+  fast_float::parse_options_t<UC> const options(
+      fast_float::chars_format::general |
+      fast_float::chars_format::skip_white_space);
+  for (size_t length = 0; length < 80; length++) {
+    for (size_t k = 0; k < sizeof(spaces); k++) {
+      std::basic_string<UC> input;
+      for (size_t i = 0; i < length; i++) {
+        input.push_back(UC(spaces[(i + k) % sizeof(spaces)]));
+      }
+      std::string const number = "-12.5";
+      input.append(number.begin(), number.end());
+      double d;
+      auto answer = fast_float::from_chars_advanced(
+          input.data(), input.data() + input.size(), d, options);
+      CHECK(answer.ec == std::errc());
+      CHECK(answer.ptr == input.data() + input.size());
+      CHECK(d == -12.5);
+      int64_t i;
+      answer = fast_float::from_chars_advanced(
+          input.data(), input.data() + input.size() - 2, i, options);
+      CHECK(answer.ec == std::errc());
+      CHECK(i == -12);
+      // Only white space
+      input.resize(length);
+      answer = fast_float::from_chars_advanced(
+          input.data(), input.data() + input.size(), d, options);
+      CHECK(answer.ec == std::errc::invalid_argument);
+    }
+    for (uint32_t unit : not_spaces) {
+      if (!fits<UC>(unit)) {
+        continue;
+      }
+      for (size_t at = 0; at <= length; at++) {
+        std::basic_string<UC> input(length, UC(' '));
+        input.insert(input.begin() + std::ptrdiff_t(at), UC(unit));
+        input.push_back(UC('7'));
+        double d;
+        auto answer = fast_float::from_chars_advanced(
+            input.data(), input.data() + input.size(), d, options);
+        CHECK(answer.ec == std::errc::invalid_argument);
+        CHECK(answer.ptr == input.data() + at);
+      }
+    }
+  }
+}
+
+TEST_CASE("skip_white_space.runs") {
+  check_runs<char>();
+  check_runs<char16_t>();
+  check_runs<char32_t>();
+  check_runs<wchar_t>();
+}
+
+// The default separators of from_chars_many are the white space.
+template <typename UC> void check_many() {
+  std::basic_string<UC> input;
+  std::vector<double> expected;
+  for (size_t length = 1; length < 70; length++) {
+    input.append(length, UC(spaces[length % sizeof(spaces)]));
+    std::string const number = std::to_string(length) + ".25";
+    input.append(number.begin(), number.end());
+    expected.push_back(double(length) + 0.25);
+  }
+  input.append(40, UC(' '));
+  std::vector<double> out(expected.size() + 1);
+  auto answer = fast_float::from_chars_many(
+      input.data(), input.data() + input.size(), out.data(), out.size());
+  CHECK(answer.ec == std::errc());
+  CHECK(answer.ptr == input.data() + input.size());
+  CHECK(answer.count == expected.size());
+  for (size_t i = 0; i < expected.size(); i++) {
+    CHECK(out[i] == expected[i]);
+  }
+  std::vector<uint32_t> integers(expected.size());
+  answer = fast_float::from_chars_many(input.data(), input.data() + 40,
+                                       integers.data(), integers.size());
+  // "1.25" is not an integer token.
+  CHECK(answer.ec == std::errc::invalid_argument);
+  CHECK(answer.count == 0);
+  CHECK(answer.ptr == input.data() + 1);
+}
+
+TEST_CASE("skip_white_space.many") {
+  check_many<char>();
+  check_many<char16_t>();
+  check_many<char32_t>();
+  check_many<wchar_t>();
+}
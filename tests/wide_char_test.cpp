@@ -1,5 +1,7 @@
 #include "fast_float/fast_float.h"
+#include <cstdint>
 #include <iostream>
+#include <limits>
 #include <string>
 #include <system_error>
 
@@ -46,8 +48,63 @@ bool test_nan() {
   return tester("nan", std::numeric_limits<double>::quiet_NaN());
 }
 
+// The runs of digits are read eight code units at a time: a code unit that is
+// a digit once truncated to 8 or 16 bits must end the number.
+template <typename UC> bool test_long_runs() {
+  std::string const s = "1234567890123456789012.34567890123456789";
+  std::basic_string<UC> const input(s.begin(), s.end());
+  for (size_t i = 0; i < s.size(); i++) {
+    for (uint32_t offset : {0x100u, 0x10000u, 0x7FFF0000u}) {
+      if (offset > uint32_t(std::numeric_limits<UC>::max())) {
+        continue;
+      }
+      std::basic_string<UC> altered = input;
+      altered[i] = UC(uint32_t(altered[i]) + offset);
+      double result;
+      auto answer = fast_float::from_chars(
+          altered.data(), altered.data() + altered.size(), result);
+      if (i == 0) {
+        if (answer.ec == std::errc()) {
+          std::cerr << "parsing with a bad first code unit should fail\n";
+          return false;
+        }
+        continue;
+      }
+      // The number is the prefix before the altered code unit.
+      std::string const prefix = s.substr(0, i);
+      double expected;
+      fast_float::from_chars(prefix.data(), prefix.data() + prefix.size(),
+                             expected);
+      if (answer.ec != std::errc() ||
+          answer.ptr != altered.data() + prefix.size() || result != expected) {
+        std::cerr << "parsing with a bad code unit at " << i
+                  << " should stop there\n";
+        return false;
+      }
+    }
+  }
+  double result;
+  auto answer =
+      fast_float::from_chars(input.data(), input.data() + input.size(), result);
+  if (answer.ec != std::errc() ||
+      result != 1234567890123456789012.34567890123456789) {
+    std::cerr << "parsing of the long input failed\n";
+    return false;
+  }
+  uint64_t integer;
+  auto int_answer =
+      fast_float::from_chars(input.data(), input.data() + 19, integer);
+  if (int_answer.ec != std::errc() || integer != 1234567890123456789u) {
+    std::cerr << "parsing of the long integer failed\n";
+    return false;
+  }
+  return true;
+}
+
 int main() {
-  if (test_minus() && test_plus() && test_space() && test_nan()) {
+  if (test_minus() && test_plus() && test_space() && test_nan() &&
+      test_long_runs<wchar_t>() && test_long_runs<char32_t>() &&
+      test_long_runs<char16_t>()) {
     std::cout << "all ok" << std::endl;
     return EXIT_SUCCESS;
   }